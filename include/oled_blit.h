@@ -0,0 +1,143 @@
+// oled_blit.h
+//
+// Byte-wise canvas blitter for the canonical display layout: column-major,
+// one byte per 8 rows (byte x * pages + y / 8, LSB = top), which is what the
+// SSD1306 consumes in vertical addressing mode and what olEDitor exports.
+//
+// When the destination y is page-aligned every source byte is copied whole;
+// otherwise each source byte is shifted and merged into the two destination
+// bytes it straddles. oled_blit_canvas() takes size and encoding from a
+// PROGMEM oled_canvas at run time; the digits are page-mask encoded, so a
+// raw-only compile-time-sized copy would have no caller.
+
+#ifndef OLED_BLIT_H
+#define OLED_BLIT_H
+
+#include <avr/pgmspace.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "oled_canvas.h"
+
+// A column-major destination covering screen columns [x0, x0 + width) and
+// pages [p0, p0 + pages): the whole screen, or a strip of one page.
+struct oled_target {
+    uint8_t *buf;
+    uint8_t x0;
+    uint8_t width;
+    uint8_t p0;
+    uint8_t pages;
+};
+
+// Column readers over PROGMEM canvas data, one per encoding. Consumers
+// seek() to a starting column, then walk columns left to right with next()
+// and read source pages with get() (any order) or column() (all of them),
+// so encoded canvases are decoded on the fly, one column at a time.
+
+// OLED_ENC_RAW: width * pages bytes, column-major.
+struct oled_raw_source {
+    const uint8_t *col;
+    uint8_t pages;
+
+    void seek(uint8_t cx) { col += uint16_t(cx) * pages; }
+    void next() { col += pages; }
+    uint8_t get(uint8_t sp) const { return pgm_read_byte(col + sp); }
+    void column(uint8_t *out) const { memcpy_P(out, col, pages); }
+};
+
+static inline uint8_t oled_popcount(uint8_t v) {
+    uint8_t n = 0;
+    for (; v; v &= v - 1) ++n;
+    return n;
+}
+
+// OLED_ENC_PAGEMASK: one mask byte per column (bit p set = page p is not
+// blank), then the non-blank page bytes, column by column, top to bottom.
+struct oled_pagemask_source {
+    const uint8_t *mask;  // mask byte of the current column
+    const uint8_t *bytes; // first stored byte of the current column
+    uint8_t m;            // current mask
+    uint8_t pages;
+
+    oled_pagemask_source(const uint8_t *data, uint8_t width, uint8_t srcPages)
+        : mask(data), bytes(data + width), m(pgm_read_byte(data)), pages(srcPages) {}
+
+    void seek(uint8_t cx) { while (cx--) next(); }
+    void next() {
+        bytes += oled_popcount(m);
+        m = pgm_read_byte(++mask);            // one past the last column reads data: harmless
+    }
+    uint8_t get(uint8_t sp) const {
+        uint8_t bit = uint8_t(1 << sp);
+        if (!(m & bit)) return 0;
+        return pgm_read_byte(bytes + oled_popcount(m & uint8_t(bit - 1)));
+    }
+    void column(uint8_t *out) const {
+        const uint8_t *src = bytes;
+        uint8_t bits = m;
+        for (uint8_t sp = 0; sp < pages; ++sp, bits >>= 1) {
+            out[sp] = (bits & 1) ? pgm_read_byte(src++) : 0;
+        }
+    }
+};
+
+// Copy a w x (srcPages * 8) canvas read through `src` to screen position
+// (x, y), clipped to the target. Destination rows outside the canvas are
+// preserved. Only source pages that land in the target are read.
+template<typename Source>
+static inline __attribute__((always_inline))
+void oled_blit_impl(const oled_target &dst, uint8_t x, uint8_t y,
+                    uint8_t w, uint8_t srcPages, Source src) {
+    // Clip columns to the target
+    uint8_t cx0 = (dst.x0 > x) ? dst.x0 - x : 0;
+    int16_t cx1 = int16_t(dst.x0) + dst.width - x;
+    if (cx1 > w) cx1 = w;
+    if (cx1 <= cx0) return;
+
+    const uint8_t sh = y & 7;
+    const int8_t dp0 = int8_t(y / 8) - int8_t(dst.p0); // target page of source page 0
+
+    // Clip source pages: page sp lands on target page dp0 + sp (and on
+    // dp0 + sp + 1 when shifted)
+    int8_t sp0 = sh ? -dp0 - 1 : -dp0;
+    if (sp0 < 0) sp0 = 0;
+    int8_t sp1 = int8_t(dst.pages) - dp0;
+    if (sp1 > int8_t(srcPages)) sp1 = srcPages;
+    if (sp1 <= sp0) return;
+
+    uint8_t *dcol = dst.buf + uint16_t(x + cx0 - dst.x0) * dst.pages;
+    const uint8_t loMask = uint8_t(0xFF << sh);
+    src.seek(cx0);
+
+    for (uint8_t cx = cx0; cx < cx1; ++cx, dcol += dst.pages, src.next()) {
+        int8_t dp = dp0 + sp0;
+        if (!sh) {
+            for (uint8_t sp = sp0; sp < sp1; ++sp, ++dp) dcol[dp] = src.get(sp);
+        } else {
+            for (uint8_t sp = sp0; sp < sp1; ++sp, ++dp) {
+                uint8_t b = src.get(sp);
+                if (dp >= 0)
+                    dcol[dp] = (dcol[dp] & ~loMask) | uint8_t(b << sh);
+                if (dp + 1 < dst.pages)
+                    dcol[dp + 1] = (dcol[dp + 1] & loMask) | uint8_t(b >> (8 - sh));
+            }
+        }
+    }
+}
+
+// Blit a canvas of any encoding; `canvas` points to PROGMEM. At
+// most `maxWidth` columns are drawn (e.g. the width of the region it is
+// placed in).
+static inline void oled_blit_canvas(const oled_target &dst, uint8_t x, uint8_t y,
+                                    const oled_canvas *canvas, uint8_t maxWidth = 0xFF) {
+    oled_canvas c;
+    memcpy_P(&c, canvas, sizeof(c));
+    uint8_t w = c.width < maxWidth ? c.width : maxWidth;
+    uint8_t pages = c.height / 8;
+    if (c.encoding == OLED_ENC_PAGEMASK)
+        oled_blit_impl(dst, x, y, w, pages, oled_pagemask_source(c.data, c.width, pages));
+    else
+        oled_blit_impl(dst, x, y, w, pages, oled_raw_source{ c.data, pages });
+}
+
+#endif // OLED_BLIT_H
@@ -0,0 +1,55 @@
+// oled_canvas.h
+//
+// Types shared by the generated assets (screen_images.h, written by
+// tools/oled_assets.py from the olEDitor project) and the display driver.
+// Canvas data is column-major, one byte per 8 rows: byte
+// x * (height / 8) + y / 8, bit y % 8 (LSB = top).
+
+#ifndef OLED_CANVAS_H
+#define OLED_CANVAS_H
+
+#include <stdint.h>
+
+// a region on the screen for drawing
+struct region {
+    uint8_t x;
+    uint8_t y;
+    uint8_t width;
+    uint8_t height;
+};
+
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    const uint8_t *data;
+    uint8_t encoding; // OLED_ENC_*; 0 (raw) when left out
+    // Bounding box of the set pixels, in canvas coordinates; the driver
+    // only sends this part. Width 0 (left out) means not recorded: the whole
+    // canvas counts.
+    struct region ink;
+} oled_canvas;
+
+// Canvas data encodings (oled_canvas::encoding), decoded by the column
+// readers in oled_blit.h
+#define OLED_ENC_RAW      0 // plain column-major page bytes
+#define OLED_ENC_PAGEMASK 1 // per-column mask of non-blank pages + those bytes
+
+// A panel window as sent with 0x21/0x22: inclusive column and page ranges.
+struct oled_window {
+    uint8_t x0;
+    uint8_t x1;
+    uint8_t p0;
+    uint8_t p1;
+};
+
+// Going from canvas `from` to `to` (same size) only changes the bytes in
+// these windows, given relative to the canvas. Generated per transition
+// by tools/oled_assets.py; everything lives in PROGMEM.
+struct oled_transition {
+    const oled_canvas *from;
+    const oled_canvas *to;
+    const oled_window *windows;
+    uint8_t count;
+};
+
+#endif // OLED_CANVAS_H
@@ -1,19 +1,18 @@
-// Generated by olEDitor (Ed Diamond, 2025)
-#include <Arduino.h>
+// Generated by tools/oled_assets.py from oled_project_1764577856542.json - do not edit.
+// Canvas data is in the driver's native order (see oled_canvas.h).
 
-typedef struct {
-    uint8_t width;
-    uint8_t height;
-    const uint8_t *data;
-} oled_canvas;
+#ifndef SCREEN_IMAGES_H
+#define SCREEN_IMAGES_H
 
-// a region on the screen for drawing
-struct region {
-    uint8_t x;
-    uint8_t y;
-    uint8_t width;
-    uint8_t height;
-};
+#include <avr/pgmspace.h>
+
+#include "oled_blit.h"
+#include "oled_canvas.h"
+
+// 1 to store every canvas raw instead of encoded (more flash, no decoding)
+#ifndef OLED_ASSETS_RAW
+#define OLED_ASSETS_RAW 0
+#endif
 
 // a struct to represent the screen itself
 struct oled_screen {
@@ -23,263 +22,415 @@ struct oled_screen {
 };
 
 // Copies a canvas to a specified region on the screen, respecting position.
+// Both the region and the canvas live in PROGMEM.
 static void displayCanvas(struct oled_screen* screen, const struct region* region, const oled_canvas* canvas) {
-    if (!screen || !region || !canvas || !canvas->data) return;
-
-    const uint8_t screen_h_pages = screen->height / 8;
-
-    for (uint8_t cx = 0; cx < canvas->width; cx++) {
-        for (uint8_t cy = 0; cy < canvas->height; cy++) {
-            uint8_t screen_x = region->x + cx;
-            uint8_t screen_y = region->y + cy;
-
-            if (screen_x >= screen->width || screen_y >= screen->height) continue;
-
-            // Get pixel from canvas (data is in PROGMEM)
-            uint16_t canvas_byte_offset = cx * (canvas->height / 8) + (cy / 8);
-            uint8_t canvas_bit_offset = cy % 8;
-            uint8_t canvas_byte = pgm_read_byte(&canvas->data[canvas_byte_offset]);
-            uint8_t pixel_is_on = (canvas_byte >> canvas_bit_offset) & 1;
-
-            // Set pixel on screen
-            uint16_t screen_byte_offset = screen_x * screen_h_pages + (screen_y / 8);
-            uint8_t screen_bit_offset = screen_y % 8;
-
-            if (pixel_is_on) {
-                screen->buffer[screen_byte_offset] |= (1 << screen_bit_offset);
-            } else {
-                screen->buffer[screen_byte_offset] &= ~(1 << screen_bit_offset);
-            }
-        }
-    }
+    if (!screen || !region || !canvas) return;
+
+    struct region r;
+    memcpy_P(&r, region, sizeof(r));
+    const oled_target target = { screen->buffer, 0, screen->width, 0, uint8_t(screen->height / 8) };
+    oled_blit_canvas(target, r.x, r.y, canvas, r.width);
 }
 
 // -- Canvas Structs --
+#if OLED_ASSETS_RAW
+const uint8_t number_num_0_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0xF8, 0x03, 0x00, 
+    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x18, 0x00, 
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 
+    0x00, 0x38, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x00, 0x00, 0x40, 0x00, 
+    0xC0, 0x01, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x30, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 
+    0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 
+    0x18, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 
+    0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x30, 0x00, 
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x03, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 
+    0x00, 0x60, 0x00, 0x00, 0x30, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xCF, 0x07, 0x00, 0x00, 
+    0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#else
+const uint8_t number_num_0_data[] PROGMEM = {
+    0x00, 0x00, 0x30, 0x7C, 0x44, 0x44, 0x44, 0x42, 0x4A, 0x4A, 0x4B, 0x49, 0x49, 0x49, 0x49, 0x49, 
+    0x49, 0x49, 0x41, 0x43, 0x62, 0x22, 0x32, 0x36, 0x0C, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0xFF, 
+    0x03, 0xF8, 0x03, 0x70, 0x06, 0x0C, 0x18, 0x03, 0x20, 0xC0, 0x60, 0x38, 0x40, 0x40, 0x0F, 0xC0, 
+    0x40, 0xC0, 0x01, 0x80, 0x80, 0x30, 0x80, 0x80, 0x10, 0x80, 0x80, 0x08, 0x80, 0x80, 0x18, 0x80, 
+    0x80, 0x10, 0x80, 0x40, 0x10, 0x80, 0x60, 0x30, 0xC0, 0x30, 0xE0, 0x08, 0x80, 0x01, 0x06, 0x03, 
+    0xC0, 0x01, 0x1C, 0x60, 0x60, 0x30, 0x1C, 0xC0, 0x01, 0xCF, 0x07, 0xFE, 0xFF
+};
+#endif
+
 const oled_canvas number_num_0 PROGMEM = {
     28, // width
     64, // height
-    (const uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0xF8, 0x03, 0x00, 
-        0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x18, 0x00, 
-        0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 
-        0x00, 0x38, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x00, 0x00, 0x40, 0x00, 
-        0xC0, 0x01, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x30, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 
-        0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 
-        0x18, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 
-        0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x30, 0x00, 
-        0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
-        0x00, 0x03, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 
-        0x00, 0x60, 0x00, 0x00, 0x30, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xCF, 0x07, 0x00, 0x00, 
-        0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    }
+    number_num_0_data,
+    OLED_ASSETS_RAW ? OLED_ENC_RAW : OLED_ENC_PAGEMASK,
+    { 2, 3, 23, 53 } // ink
 };
 
+#if OLED_ASSETS_RAW
+const uint8_t number_num_1_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
+    0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x08, 0xCC, 0xC1, 0x0F, 0x00, 0x00, 0xFE, 0x03, 0x08, 
+    0x7C, 0x3F, 0xF0, 0xFF, 0xFF, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#else
+const uint8_t number_num_1_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x80, 0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x81, 0x81, 0x81, 0x81, 0xC1, 
+    0xC1, 0xE7, 0xBF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x10, 0x10, 0x0C, 0x10, 
+    0x04, 0x10, 0x02, 0x10, 0x03, 0x10, 0x01, 0x10, 0x80, 0x01, 0x10, 0xC0, 0x10, 0x40, 0x10, 0x20, 
+    0x10, 0x10, 0x18, 0x10, 0x80, 0x0F, 0x08, 0x7E, 0x08, 0xCC, 0xC1, 0x0F, 0xFE, 0x03, 0x08, 0x7C, 
+    0x3F, 0xF0, 0xFF, 0xFF, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x08
+};
+#endif
+
 const oled_canvas number_num_1 PROGMEM = {
     28, // width
     64, // height
-    (const uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-        0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-        0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-        0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-        0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 
-        0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x08, 0xCC, 0xC1, 0x0F, 0x00, 0x00, 0xFE, 0x03, 0x08, 
-        0x7C, 0x3F, 0xF0, 0xFF, 0xFF, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    }
+    number_num_1_data,
+    OLED_ASSETS_RAW ? OLED_ENC_RAW : OLED_ENC_PAGEMASK,
+    { 3, 2, 23, 59 } // ink
+};
+
+#if OLED_ASSETS_RAW
+const uint8_t number_num_2_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x02, 
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x01, 
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x01, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 
+    0x08, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00, 
+    0x08, 0x00, 0x00, 0x70, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x00, 
+    0x08, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x70, 0x00, 0x00, 0x00, 0x80, 0x00, 
+    0x10, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x00, 
+    0x20, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 
+    0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#else
+const uint8_t number_num_2_data[] PROGMEM = {
+    0x00, 0x00, 0xC2, 0xC2, 0xC2, 0xE3, 0xA1, 0xA1, 0xA1, 0x91, 0x51, 0x49, 0x49, 0x49, 0x4D, 0x45, 
+    0x45, 0x45, 0x47, 0x43, 0x43, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x08, 0x80, 0x03, 0x0C, 
+    0xE0, 0x02, 0x06, 0x3C, 0x03, 0x80, 0x01, 0xC0, 0x03, 0x01, 0xC0, 0x30, 0x01, 0x20, 0x1C, 0x01, 
+    0x30, 0x07, 0x01, 0x10, 0xE0, 0x01, 0x08, 0x3F, 0x80, 0x08, 0xC0, 0x80, 0x08, 0x70, 0x80, 0x08, 
+    0x1E, 0x80, 0x08, 0xC0, 0x03, 0x80, 0x08, 0x70, 0x80, 0x10, 0x0C, 0x80, 0x10, 0x03, 0x80, 0x20, 
+    0xF0, 0x01, 0x80, 0xE0, 0x1F, 0xC0, 0x80, 0x01, 0x40, 0x40, 0x40, 0x40, 0x60
 };
+#endif
 
 const oled_canvas number_num_2 PROGMEM = {
     28, // width
     64, // height
-    (const uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x02, 
-        0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x01, 
-        0xC0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x01, 
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 
-        0x08, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00, 
-        0x08, 0x00, 0x00, 0x70, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x00, 
-        0x08, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x70, 0x00, 0x00, 0x00, 0x80, 0x00, 
-        0x10, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x00, 
-        0x20, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 
-        0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    }
+    number_num_2_data,
+    OLED_ASSETS_RAW ? OLED_ENC_RAW : OLED_ENC_PAGEMASK,
+    { 2, 3, 23, 55 } // ink
+};
+
+#if OLED_ASSETS_RAW
+const uint8_t number_num_3_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 
+    0x10, 0x00, 0x70, 0x00, 0x00, 0x00, 0x80, 0x01, 0x10, 0x00, 0x58, 0x00, 0x00, 0x00, 0xC0, 0x00, 
+    0x10, 0x00, 0x48, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x30, 0x00, 
+    0x10, 0x00, 0x84, 0x01, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x04, 0x03, 0x00, 0x00, 0x08, 0x00, 
+    0x30, 0x00, 0x06, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x20, 0x00, 0x02, 0x0C, 0x00, 0x00, 0x04, 0x00, 
+    0x20, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03, 0x00, 0x60, 0x00, 0x01, 0xC0, 0x01, 0x80, 0x01, 0x00, 
+    0x40, 0x80, 0x01, 0x00, 0x06, 0x70, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
+    0x80, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#else
+const uint8_t number_num_3_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x81, 0x81, 0x81, 0x81, 0x85, 0xC5, 0x45, 0x45, 0x45, 0x4D, 0x4D, 0x4D, 0x4D, 
+    0x4D, 0x7D, 0x37, 0x33, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x30, 0x02, 
+    0x10, 0x02, 0x10, 0x03, 0x10, 0x60, 0x01, 0x10, 0x70, 0x80, 0x01, 0x10, 0x58, 0xC0, 0x10, 0x48, 
+    0x40, 0x10, 0x8C, 0x30, 0x10, 0x84, 0x01, 0x10, 0x10, 0x04, 0x03, 0x08, 0x30, 0x06, 0x06, 0x0C, 
+    0x20, 0x02, 0x0C, 0x04, 0x20, 0x03, 0x30, 0x03, 0x60, 0x01, 0xC0, 0x01, 0x80, 0x01, 0x40, 0x80, 
+    0x01, 0x06, 0x70, 0xC0, 0xC0, 0xF8, 0x0F, 0x80, 0x71, 0x1B, 0x0E
 };
+#endif
 
 const oled_canvas number_num_3 PROGMEM = {
     28, // width
     64, // height
-    (const uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 
-        0x10, 0x00, 0x70, 0x00, 0x00, 0x00, 0x80, 0x01, 0x10, 0x00, 0x58, 0x00, 0x00, 0x00, 0xC0, 0x00, 
-        0x10, 0x00, 0x48, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x30, 0x00, 
-        0x10, 0x00, 0x84, 0x01, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x04, 0x03, 0x00, 0x00, 0x08, 0x00, 
-        0x30, 0x00, 0x06, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x20, 0x00, 0x02, 0x0C, 0x00, 0x00, 0x04, 0x00, 
-        0x20, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03, 0x00, 0x60, 0x00, 0x01, 0xC0, 0x01, 0x80, 0x01, 0x00, 
-        0x40, 0x80, 0x01, 0x00, 0x06, 0x70, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-        0x80, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    }
+    number_num_3_data,
+    OLED_ASSETS_RAW ? OLED_ENC_RAW : OLED_ENC_PAGEMASK,
+    { 3, 4, 20, 54 } // ink
 };
 
+#if OLED_ASSETS_RAW
+const uint8_t number_num_4_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xC0, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xC0, 0xFD, 0x0F, 
+    0x00, 0x00, 0x00, 0x04, 0xE0, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#else
+const uint8_t number_num_4_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x0C, 0x0E, 0x0B, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0xE8, 
+    0x78, 0x18, 0x0C, 0x0C, 0x0B, 0x0B, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x07, 
+    0x08, 0xFC, 0x3F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x38, 0x0C, 0xC0, 
+    0xFD, 0x0F, 0x04, 0xE0, 0x3F, 0x07, 0xFC, 0x3F, 0xF8, 0x07, 0x07, 0x04, 0x08, 0xF8, 0x04, 0xF8, 
+    0x07, 0x04, 0x04, 0x04
+};
+#endif
+
 const oled_canvas number_num_4 PROGMEM = {
     28, // width
     64, // height
-    (const uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0xC0, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xC0, 0xFD, 0x0F, 
-        0x00, 0x00, 0x00, 0x04, 0xE0, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 
-        0x08, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    }
+    number_num_4_data,
+    OLED_ASSETS_RAW ? OLED_ENC_RAW : OLED_ENC_PAGEMASK,
+    { 3, 2, 21, 60 } // ink
+};
+
+#if OLED_ASSETS_RAW
+const uint8_t number_num_5_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+    0xF8, 0x7F, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x08, 0x10, 0xC0, 0x01, 0x38, 0x00, 0x00, 0x00, 0x08, 
+    0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 
+    0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x06, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 
+    0x10, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 
+    0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x80, 0x01, 0x00, 0xC0, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x20, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x04, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#else
+const uint8_t number_num_5_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x80, 0x8F, 0x8F, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x49, 0x59, 0x51, 0x51, 
+    0x51, 0x51, 0x51, 0x51, 0x61, 0x61, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x7F, 0xFF, 
+    0x3F, 0x08, 0x10, 0xC0, 0x01, 0x38, 0x08, 0x10, 0x20, 0x0C, 0x10, 0x20, 0x04, 0x10, 0x20, 0x06, 
+    0x10, 0x20, 0x02, 0x10, 0x60, 0x03, 0x10, 0x40, 0x01, 0x10, 0x80, 0x80, 0x10, 0x80, 0x01, 0xC0, 
+    0x10, 0x03, 0x60, 0x10, 0x06, 0x20, 0x10, 0x0C, 0x10, 0x10, 0x08, 0x18, 0x10, 0x30, 0x08, 0x10, 
+    0xE0, 0x04, 0x10, 0x07, 0x04, 0x10, 0x18, 0x03, 0x10, 0xE0
 };
+#endif
 
 const oled_canvas number_num_5 PROGMEM = {
     28, // width
     64, // height
-    (const uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-        0xF8, 0x7F, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x08, 0x10, 0xC0, 0x01, 0x38, 0x00, 0x00, 0x00, 0x08, 
-        0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 
-        0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x06, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 
-        0x10, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 
-        0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x80, 0x01, 0x00, 0xC0, 0x00, 
-        0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x20, 0x00, 
-        0x10, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 
-        0x10, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x04, 0x00, 
-        0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 
-        0x10, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    }
+    number_num_5_data,
+    OLED_ASSETS_RAW ? OLED_ENC_RAW : OLED_ENC_PAGEMASK,
+    { 3, 3, 20, 57 } // ink
 };
 
+#if OLED_ASSETS_RAW
+const uint8_t number_num_6_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xCF, 0x81, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x60, 0x00, 0x70, 0x00, 
+    0x00, 0x00, 0xC0, 0x03, 0x20, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x30, 0x00, 0x80, 0x00, 
+    0x00, 0x00, 0x0E, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x80, 0x01, 0x00, 0x18, 0x00, 0x80, 0x00, 
+    0x00, 0xE0, 0x00, 0x00, 0x08, 0x00, 0x80, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x00, 
+    0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 
+    0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 
+    0x30, 0x00, 0x00, 0x00, 0x08, 0x00, 0x60, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#else
+const uint8_t number_num_6_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0x58, 0x58, 0x5C, 0x54, 0x54, 0x56, 0x52, 0x52, 0x52, 0x52, 
+    0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x50, 0x70, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xC0, 0xCF, 
+    0x81, 0x07, 0x38, 0x40, 0x1C, 0x0E, 0x60, 0x70, 0xC0, 0x03, 0x20, 0xC0, 0x78, 0x30, 0x80, 0x0E, 
+    0x10, 0x80, 0x80, 0x01, 0x18, 0x80, 0xE0, 0x08, 0x80, 0x30, 0x0C, 0x80, 0x0C, 0x04, 0x80, 0x06, 
+    0x04, 0x80, 0x03, 0x04, 0xC0, 0xC0, 0x08, 0x40, 0x30, 0x08, 0x60, 0x18, 0x08, 0x20, 0x08, 0x10, 
+    0x10, 0x30, 0x08, 0x20, 0x0C, 0xC0, 0x07, 0x80, 0xFF, 0x01
+};
+#endif
+
 const oled_canvas number_num_6 PROGMEM = {
     28, // width
     64, // height
-    (const uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xCF, 0x81, 0x07, 0x00, 
-        0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x60, 0x00, 0x70, 0x00, 
-        0x00, 0x00, 0xC0, 0x03, 0x20, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x30, 0x00, 0x80, 0x00, 
-        0x00, 0x00, 0x0E, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x80, 0x01, 0x00, 0x18, 0x00, 0x80, 0x00, 
-        0x00, 0xE0, 0x00, 0x00, 0x08, 0x00, 0x80, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x00, 
-        0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 
-        0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 
-        0x30, 0x00, 0x00, 0x00, 0x08, 0x00, 0x60, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x00, 
-        0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x07, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    }
+    number_num_6_data,
+    OLED_ASSETS_RAW ? OLED_ENC_RAW : OLED_ENC_PAGEMASK,
+    { 4, 3, 21, 53 } // ink
+};
+
+#if OLED_ASSETS_RAW
+const uint8_t number_num_7_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
+    0xD0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0xC0, 0x01, 0x00, 
+    0x10, 0x00, 0x00, 0x0C, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0xC0, 0x01, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x18, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x88, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#else
+const uint8_t number_num_7_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x81, 0xC3, 0x41, 0x41, 0x69, 0x29, 0x29, 0x29, 0x39, 0x19, 0x19, 0x09, 0x09, 
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x00, 0x70, 0x06, 0xD0, 0x01, 
+    0x80, 0x07, 0x10, 0xF8, 0x10, 0x0F, 0x10, 0x08, 0xC0, 0x01, 0x10, 0x0C, 0x38, 0x18, 0x08, 0x0C, 
+    0x08, 0x08, 0x03, 0x08, 0x08, 0xC0, 0x01, 0x08, 0x08, 0x7C, 0x08, 0x08, 0x07, 0x08, 0xF8, 0x08, 
+    0x0E, 0x08, 0x80, 0x05, 0x08, 0x60, 0x04, 0x08, 0x1C, 0x04, 0x08, 0x07, 0x04, 0x08, 0xC0, 0x04, 
+    0x08, 0x70, 0x04, 0x08, 0x18, 0x04, 0x88, 0x07, 0x04, 0xFC, 0x1C, 0x0C
 };
+#endif
 
 const oled_canvas number_num_7 PROGMEM = {
     28, // width
     64, // height
-    (const uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
-        0xD0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 
-        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0xC0, 0x01, 0x00, 
-        0x10, 0x00, 0x00, 0x0C, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x00, 
-        0x08, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0xC0, 0x01, 0x00, 0x00, 
-        0x08, 0x00, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 
-        0x08, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-        0x08, 0x00, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 
-        0x08, 0x00, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 
-        0x08, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-        0x08, 0x18, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x88, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-        0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    }
+    number_num_7_data,
+    OLED_ASSETS_RAW ? OLED_ENC_RAW : OLED_ENC_PAGEMASK,
+    { 3, 2, 24, 57 } // ink
 };
 
+#if OLED_ASSETS_RAW
+const uint8_t number_num_8_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x0F, 0x00, 
+    0x00, 0xE0, 0x01, 0x00, 0x9E, 0x03, 0x70, 0x00, 0x00, 0x1C, 0x03, 0x00, 0xF3, 0x00, 0xC0, 0x00, 
+    0x00, 0x07, 0x0E, 0xC0, 0x01, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x08, 0x60, 0x00, 0x00, 0x00, 0x06, 
+    0x60, 0x00, 0x70, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x30, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x04, 
+    0x18, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x00, 0x70, 0x0C, 0x00, 0x00, 0x00, 0x04, 
+    0x04, 0x00, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x06, 0x70, 0x00, 0x00, 0x00, 0x04, 
+    0x04, 0x00, 0x01, 0xC0, 0x01, 0x00, 0x00, 0x02, 0x04, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 
+    0x04, 0x38, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x01, 0x06, 0x0E, 0x00, 0x00, 0x18, 0x00, 0x80, 0x01, 
+    0xF8, 0x03, 0x00, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x78, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#else
+const uint8_t number_num_8_data[] PROGMEM = {
+    0x00, 0x00, 0x20, 0x60, 0x76, 0x56, 0xDE, 0x8F, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x9D, 0x93, 
+    0x93, 0xD3, 0x53, 0x70, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x8C, 0x0F, 0xE0, 
+    0x01, 0x9E, 0x03, 0x70, 0x1C, 0x03, 0xF3, 0xC0, 0x07, 0x0E, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x01, 
+    0x08, 0x60, 0x06, 0x60, 0x70, 0x3C, 0x04, 0x30, 0xC0, 0x07, 0x04, 0x18, 0xC0, 0x03, 0x04, 0x0C, 
+    0x70, 0x0C, 0x04, 0x04, 0x1C, 0x18, 0x04, 0x04, 0x06, 0x70, 0x04, 0x04, 0x01, 0xC0, 0x01, 0x02, 
+    0x04, 0xC0, 0x03, 0x03, 0x04, 0x38, 0x0C, 0x01, 0x06, 0x0E, 0x18, 0x80, 0x01, 0xF8, 0x03, 0xE0, 
+    0xC0, 0x80, 0x1F, 0x78, 0xE0, 0x07
+};
+#endif
+
 const oled_canvas number_num_8 PROGMEM = {
     28, // width
     64, // height
-    (const uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x0F, 0x00, 
-        0x00, 0xE0, 0x01, 0x00, 0x9E, 0x03, 0x70, 0x00, 0x00, 0x1C, 0x03, 0x00, 0xF3, 0x00, 0xC0, 0x00, 
-        0x00, 0x07, 0x0E, 0xC0, 0x01, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x08, 0x60, 0x00, 0x00, 0x00, 0x06, 
-        0x60, 0x00, 0x70, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x30, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x04, 
-        0x18, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x00, 0x70, 0x0C, 0x00, 0x00, 0x00, 0x04, 
-        0x04, 0x00, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x06, 0x70, 0x00, 0x00, 0x00, 0x04, 
-        0x04, 0x00, 0x01, 0xC0, 0x01, 0x00, 0x00, 0x02, 0x04, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 
-        0x04, 0x38, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x01, 0x06, 0x0E, 0x00, 0x00, 0x18, 0x00, 0x80, 0x01, 
-        0xF8, 0x03, 0x00, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x78, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    }
+    number_num_8_data,
+    OLED_ASSETS_RAW ? OLED_ENC_RAW : OLED_ENC_PAGEMASK,
+    { 2, 1, 19, 58 } // ink
 };
 
+#if OLED_ASSETS_RAW
+const uint8_t number_num_9_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xC0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 
+    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 
+    0x02, 0x20, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 
+    0x04, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x04, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xE2, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#else
+const uint8_t number_num_9_data[] PROGMEM = {
+    0x00, 0x00, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xC3, 0x43, 0x63, 
+    0x23, 0x33, 0x13, 0x0B, 0x0B, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x01, 0x00, 0x1E, 0x80, 0x31, 0xC0, 
+    0x40, 0x40, 0x30, 0x80, 0x18, 0x80, 0x0C, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x40, 
+    0x04, 0x40, 0xE0, 0x01, 0x02, 0x40, 0x3E, 0x02, 0x40, 0xE0, 0x01, 0x02, 0x20, 0x3E, 0x02, 0x20, 
+    0xF8, 0x03, 0x04, 0x10, 0x0F, 0x04, 0x10, 0xE0, 0x04, 0x08, 0x3E, 0x04, 0x0C, 0xC0, 0x03, 0x04, 
+    0x04, 0x3C, 0x02, 0xF6, 0x03, 0xE2, 0x0F, 0xFE, 0x0C
+};
+#endif
+
 const oled_canvas number_num_9 PROGMEM = {
     28, // width
     64, // height
-    (const uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0xC0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x30, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 
-        0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 
-        0x02, 0x20, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 
-        0x04, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 
-        0x04, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 
-        0x04, 0x04, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0xE2, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    }
+    number_num_9_data,
+    OLED_ASSETS_RAW ? OLED_ENC_RAW : OLED_ENC_PAGEMASK,
+    { 2, 1, 25, 56 } // ink
+};
+
+const oled_canvas *const number_canvases[10] PROGMEM = {
+    &number_num_0, &number_num_1, &number_num_2, &number_num_3, &number_num_4,
+    &number_num_5, &number_num_6, &number_num_7, &number_num_8, &number_num_9
+};
+
+#if OLED_ASSETS_RAW
+const uint8_t colon_char_colon_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 
+    0x00, 0x60, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
+#else
+const uint8_t colon_char_colon_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x62, 0x62, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x40, 0xE0, 0x80, 0x03, 0x60, 0xC0, 0x03, 0x20, 0xC0
+};
+#endif
 
 const oled_canvas colon_char_colon PROGMEM = {
     16, // width
     64, // height
-    (const uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 
-        0x00, 0x60, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    }
+    colon_char_colon_data,
+    OLED_ASSETS_RAW ? OLED_ENC_RAW : OLED_ENC_PAGEMASK,
+    { 6, 13, 4, 37 } // ink
+};
+
+const oled_canvas *const colon_canvases[1] PROGMEM = {
+    &colon_char_colon
 };
 
+// Transitions with delta windows, for GME12864_OLED::setTransitions()
+constexpr uint8_t SCREEN_TRANSITION_COUNT = 0;
+const oled_transition *const screen_transitions = nullptr;
+
 // Pre-defined regions for drawing
 const struct region hour_tens PROGMEM = { .x = 0, .y = 0, .width = 28, .height = 64 };
 const struct region hour_ones PROGMEM = { .x = 28, .y = 0, .width = 28, .height = 64 };
@@ -287,3 +438,8 @@ const struct region colon PROGMEM = { .x = 56, .y = 0, .width = 16, .height = 64
 const struct region minute_tens PROGMEM = { .x = 72, .y = 0, .width = 28, .height = 64 };
 const struct region minute_ones PROGMEM = { .x = 100, .y = 0, .width = 28, .height = 64 };
 
+// Screen area the regions can draw ink into (e.g. the rows for
+// GME12864_OLED::setUsedRows())
+constexpr struct region screen_ink = { 2, 1, 125, 61 };
+
+#endif // SCREEN_IMAGES_H
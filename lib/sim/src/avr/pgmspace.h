@@ -0,0 +1,21 @@
+// avr/pgmspace.h for host builds: flash and SRAM are the same address space,
+// so PROGMEM is a no-op and the pgm_read_* accessors are plain loads.
+
+#ifndef SIM_AVR_PGMSPACE_H
+#define SIM_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s) (s)
+
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(const void * const *)(addr))
+
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#endif // SIM_AVR_PGMSPACE_H
@@ -0,0 +1,149 @@
+// sim_bus.cpp
+//
+// See sim_bus.h. A transaction runs from START to STOP (or to the next
+// repeated START); its first byte is the address byte.
+
+#include "sim_bus.h"
+
+namespace {
+
+SimDevice *devices[128];
+SimBus::Stats stats_;
+std::vector<SimBus::Transaction> log_;
+bool recording;
+
+bool inTransaction;
+bool addressPhase;
+bool reading;
+SimDevice *current;
+
+uint32_t nackCountdown;
+bool sclStuck;
+uint8_t sdaClocks;
+
+void finish() {
+    if (inTransaction && current) current->stop();
+    inTransaction = false;
+    current = nullptr;
+}
+
+void record(uint8_t b, bool ack) {
+    if (!recording || log_.empty()) return;
+    SimBus::Transaction &t = log_.back();
+    t.data.push_back(b);
+    if (!ack) t.acked = false;
+}
+
+} // namespace
+
+void SimBus::attach(uint8_t addr7, SimDevice *dev) {
+    devices[addr7 & 0x7F] = dev;
+}
+
+void SimBus::detach(uint8_t addr7) {
+    devices[addr7 & 0x7F] = nullptr;
+}
+
+void SimBus::reset() {
+    for (SimDevice *&d : devices) d = nullptr;
+    inTransaction = false;
+    current = nullptr;
+    clearStats();
+    clearLog();
+    clearFaults();
+}
+
+const SimBus::Stats &SimBus::stats() {
+    return stats_;
+}
+
+void SimBus::clearStats() {
+    stats_ = Stats();
+}
+
+void SimBus::setRecording(bool on) {
+    recording = on;
+}
+
+const std::vector<SimBus::Transaction> &SimBus::log() {
+    return log_;
+}
+
+void SimBus::clearLog() {
+    log_.clear();
+}
+
+void SimBus::nackByte(uint32_t n) {
+    nackCountdown = n;
+}
+
+void SimBus::holdScl(bool on) {
+    sclStuck = on;
+}
+
+void SimBus::holdSda(uint8_t clocks) {
+    sdaClocks = clocks;
+}
+
+void SimBus::clearFaults() {
+    nackCountdown = 0;
+    sclStuck = false;
+    sdaClocks = 0;
+}
+
+bool SimBus::sclHeld() {
+    return sclStuck;
+}
+
+bool SimBus::sdaHeld() {
+    return sdaClocks != 0;
+}
+
+void SimBus::start() {
+    finish();
+    inTransaction = true;
+    addressPhase = true;
+    ++stats_.transactions;
+}
+
+void SimBus::stop() {
+    if (inTransaction) ++stats_.stops;
+    finish();
+}
+
+bool SimBus::write(uint8_t b) {
+    ++stats_.bytes;
+    bool ack = false;
+    if (!inTransaction) {
+        // bytes outside START..STOP go nowhere
+    } else if (addressPhase) {
+        addressPhase = false;
+        reading = b & 1;
+        current = devices[b >> 1];
+        if (current) current->start(reading);
+        ack = current != nullptr;
+        if (recording) log_.push_back(Transaction{ uint8_t(b >> 1), reading, true, {} });
+        if (!ack && recording) log_.back().acked = false;
+    } else if (current && !reading) {
+        if (nackCountdown && --nackCountdown == 0) {
+            ack = false;       // refused, never reaches the device
+        } else {
+            ack = current->write(b);
+        }
+        record(b, ack);
+    }
+    if (!ack) ++stats_.nacks;
+    return ack;
+}
+
+uint8_t SimBus::read(bool ack) {
+    ++stats_.bytes;
+    uint8_t b = (inTransaction && current && reading) ? current->read(ack) : 0xFF;
+    record(b, true);
+    return b;
+}
+
+void SimBus::clock() {
+    ++stats_.clocks;
+    if (sdaClocks && sdaClocks != 0xFF) --sdaClocks;
+}
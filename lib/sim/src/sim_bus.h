@@ -0,0 +1,74 @@
+// sim_bus.h
+//
+// Software I2C bus for host builds. The SIM backend of the I2C class
+// (src/i2c_sim.cpp) forwards every START, byte and STOP here; the bus
+// counts what goes over the wire, optionally records each transaction, and
+// routes bytes to the device models attached at 7-bit addresses. Faults can
+// be injected to exercise the master's error paths: a NACKed data byte, a
+// slave stretching SCL forever, a slave holding SDA low.
+
+#ifndef SIM_BUS_H
+#define SIM_BUS_H
+
+#include <stdint.h>
+#include <vector>
+
+// A slave on the simulated bus. start() is called once the address byte
+// matched; write() returns the ACK for each byte the master sends.
+class SimDevice {
+public:
+    virtual ~SimDevice() {}
+    virtual void start(bool read) { (void)read; }
+    virtual bool write(uint8_t b) = 0;
+    virtual uint8_t read(bool ack) { (void)ack; return 0xFF; }
+    virtual void stop() {}
+};
+
+class SimBus {
+public:
+    struct Stats {
+        uint32_t transactions; // START (and repeated START) conditions
+        uint32_t stops;        // STOP conditions
+        uint32_t bytes;        // bytes clocked, incl. address bytes
+        uint32_t nacks;        // bytes not acknowledged
+        uint32_t clocks;       // bare SCL pulses (bus clear)
+    };
+
+    struct Transaction {
+        uint8_t addr7;
+        bool read;
+        bool acked;            // every byte was ACKed
+        std::vector<uint8_t> data;
+    };
+
+    static void attach(uint8_t addr7, SimDevice *dev);
+    static void detach(uint8_t addr7);
+    static void reset();       // detach everything, clear stats, log and faults
+
+    static const Stats &stats();
+    static void clearStats();
+
+    // Keep a copy of every transaction (off by default)
+    static void setRecording(bool on);
+    static const std::vector<Transaction> &log();
+    static void clearLog();
+
+    // Fault injection, cleared by clearFaults() and reset()
+    static void nackByte(uint32_t n);  // NACK (and drop) the n-th data byte written from now, 0 = off
+    static void holdScl(bool on);      // a slave stretches SCL until released
+    static void holdSda(uint8_t clocks); // a slave holds SDA low for `clocks` SCL pulses, 0xFF = for good
+    static void clearFaults();
+
+    // Line state for the SIM backend
+    static bool sclHeld();
+    static bool sdaHeld();
+
+    // Bus primitives, called by the I2C SIM backend
+    static void start();
+    static void stop();
+    static bool write(uint8_t b);
+    static uint8_t read(bool ack);
+    static void clock();       // one SCL pulse outside a byte (bus clear)
+};
+
+#endif // SIM_BUS_H
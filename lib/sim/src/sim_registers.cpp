@@ -0,0 +1,27 @@
+// sim_registers.cpp
+//
+// See sim_registers.h.
+
+#include "sim_registers.h"
+
+void SimRegisters::start(bool read) {
+    pointerNext_ = !read;
+}
+
+bool SimRegisters::write(uint8_t b) {
+    if (pointerNext_) {
+        pointerNext_ = false;
+        pointer_ = uint8_t(b % size_);
+        return true;
+    }
+    regs[pointer_] = b;
+    pointer_ = uint8_t((pointer_ + 1) % size_);
+    return true;
+}
+
+uint8_t SimRegisters::read(bool ack) {
+    (void)ack;
+    uint8_t b = regs[pointer_];
+    pointer_ = uint8_t((pointer_ + 1) % size_);
+    return b;
+}
@@ -0,0 +1,35 @@
+// sim_registers.h
+//
+// Generic register-file slave for host builds, behaving like the usual
+// I2C sensor/RTC: the first byte of a write sets the register pointer, any
+// further bytes are stored from there on, and reads return registers from
+// the pointer on. The pointer auto-increments (wrapping at `size`) and is
+// kept across transactions, so a pointer write followed by a repeated
+// START and a read fetches a burst of registers.
+
+#ifndef SIM_REGISTERS_H
+#define SIM_REGISTERS_H
+
+#include <stdint.h>
+
+#include "sim_bus.h"
+
+class SimRegisters : public SimDevice {
+public:
+    explicit SimRegisters(uint16_t size = 256) : size_(size > 256 ? 256 : size) {}
+
+    uint8_t regs[256] = {};
+    uint8_t pointer() const { return pointer_; }
+
+    // SimDevice
+    void start(bool read) override;
+    bool write(uint8_t b) override;
+    uint8_t read(bool ack) override;
+
+private:
+    uint16_t size_;
+    uint8_t pointer_ = 0;
+    bool pointerNext_ = false; // the next written byte is the pointer
+};
+
+#endif // SIM_REGISTERS_H
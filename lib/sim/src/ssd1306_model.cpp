@@ -0,0 +1,186 @@
+// ssd1306_model.cpp
+//
+// See ssd1306_model.h. Command numbers and argument counts follow the
+// SSD1306 datasheet, rev 1.1, section 10.
+
+#include <string.h>
+
+#include "ssd1306_model.h"
+
+// Number of bytes (opcode included) of each command
+static uint8_t commandLength(uint8_t op) {
+    switch (op) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+        return 2;
+    case 0x21: case 0x22: case 0xA3:
+        return 3;
+    case 0x29: case 0x2A:
+        return 6;
+    case 0x26: case 0x27:
+        return 7;
+    default:
+        return 1;
+    }
+}
+
+void SSD1306Model::reset() {
+    memset(ram_, 0, sizeof(ram_));
+    expectControl_ = true;
+    continuation_ = false;
+    dataMode_ = false;
+    cmdLen_ = cmdNeed_ = 0;
+    mode_ = PAGE;
+    col_ = page_ = 0;
+    colStart_ = 0;
+    colEnd_ = WIDTH - 1;
+    pageStart_ = 0;
+    pageEnd_ = PAGES - 1;
+    displayOn_ = false;
+    chargePump_ = false;
+    inverted_ = false;
+    entireOn_ = false;
+    contrast_ = 0x7F;
+    multiplex_ = 0x3F;
+    clockDivide_ = 0x80;
+    precharge_ = 0x22;
+    vcomh_ = 0x20;
+    offset_ = 0;
+    startLine_ = 0;
+    comPins_ = 0x12;
+    scroll_ = Scroll();
+    commandBytes_ = dataBytes_ = 0;
+}
+
+void SSD1306Model::start(bool read) {
+    (void)read; // the SSD1306 has no I2C read path; reads return 0xFF
+    expectControl_ = true;
+}
+
+bool SSD1306Model::write(uint8_t b) {
+    if (expectControl_) {
+        continuation_ = b & 0x80;
+        dataMode_ = b & 0x40;
+        expectControl_ = false;
+        return true;
+    }
+    if (dataMode_) data(b);
+    else command(b);
+    // With Co = 1 every payload byte is followed by another control byte
+    if (continuation_) expectControl_ = true;
+    return true;
+}
+
+void SSD1306Model::command(uint8_t b) {
+    ++commandBytes_;
+    if (cmdLen_ == 0) cmdNeed_ = commandLength(b);
+    cmd_[cmdLen_++] = b;
+    if (cmdLen_ == cmdNeed_) {
+        execute();
+        cmdLen_ = 0;
+    }
+}
+
+void SSD1306Model::execute() {
+    const uint8_t op = cmd_[0];
+    if (op <= 0x0F) {                          // page mode: lower column nibble
+        col_ = (col_ & 0xF0) | op;
+    } else if (op <= 0x1F) {                   // page mode: upper column nibble
+        col_ = ((op & 0x07) << 4) | (col_ & 0x0F);
+    } else if (op >= 0x40 && op <= 0x7F) {
+        startLine_ = op & 0x3F;
+    } else if (op >= 0xB0 && op <= 0xB7) {
+        page_ = op & 0x07;
+    } else {
+        switch (op) {
+        case 0x20:
+            if ((cmd_[1] & 0x03) != 0x03) mode_ = Addressing(cmd_[1] & 0x03);
+            break;
+        case 0x21:
+            colStart_ = cmd_[1] & 0x7F;
+            colEnd_ = cmd_[2] & 0x7F;
+            col_ = colStart_;
+            break;
+        case 0x22:
+            pageStart_ = cmd_[1] & 0x07;
+            pageEnd_ = cmd_[2] & 0x07;
+            page_ = pageStart_;
+            break;
+        case 0x26: case 0x27:
+            scroll_.cmd = op;
+            scroll_.startPage = cmd_[2] & 0x07;
+            scroll_.interval = cmd_[3] & 0x07;
+            scroll_.endPage = cmd_[4] & 0x07;
+            scroll_.startColumn = cmd_[5];
+            scroll_.endColumn = cmd_[6];
+            scroll_.verticalOffset = 0;
+            scroll_.active = false;            // setup must follow 0x2E
+            break;
+        case 0x29: case 0x2A:
+            scroll_.cmd = op;
+            scroll_.startPage = cmd_[2] & 0x07;
+            scroll_.interval = cmd_[3] & 0x07;
+            scroll_.endPage = cmd_[4] & 0x07;
+            scroll_.verticalOffset = cmd_[5] & 0x3F;
+            scroll_.active = false;
+            break;
+        case 0x2E: scroll_.active = false; break;
+        case 0x2F: scroll_.active = scroll_.cmd != 0; break;
+        case 0x81: contrast_ = cmd_[1]; break;
+        case 0x8D: chargePump_ = (cmd_[1] & 0x04) != 0; break;
+        case 0xA3:
+            scroll_.areaTop = cmd_[1] & 0x3F;
+            scroll_.areaRows = cmd_[2] & 0x7F;
+            break;
+        case 0xA4: entireOn_ = false; break;
+        case 0xA5: entireOn_ = true; break;
+        case 0xA6: inverted_ = false; break;
+        case 0xA7: inverted_ = true; break;
+        case 0xA8: multiplex_ = cmd_[1] & 0x3F; break;
+        case 0xAE: displayOn_ = false; break;
+        case 0xAF: displayOn_ = true; break;
+        case 0xD3: offset_ = cmd_[1] & 0x3F; break;
+        case 0xD5: clockDivide_ = cmd_[1]; break;
+        case 0xD9: precharge_ = cmd_[1]; break;
+        case 0xDA: comPins_ = cmd_[1]; break;
+        case 0xDB: vcomh_ = cmd_[1]; break;
+        default: break;                        // remaps, NOP, ...
+        }
+    }
+}
+
+void SSD1306Model::data(uint8_t b) {
+    ++dataBytes_;
+    ram_[page_][col_] = b;
+    switch (mode_) {
+    case HORIZONTAL:
+        if (col_ >= colEnd_) {
+            col_ = colStart_;
+            page_ = (page_ >= pageEnd_) ? pageStart_ : page_ + 1;
+        } else {
+            ++col_;
+        }
+        break;
+    case VERTICAL:
+        if (page_ >= pageEnd_) {
+            page_ = pageStart_;
+            col_ = (col_ >= colEnd_) ? colStart_ : col_ + 1;
+        } else {
+            ++page_;
+        }
+        break;
+    case PAGE:
+        col_ = (col_ + 1) & 0x7F;
+        break;
+    }
+}
+
+void SSD1306Model::dump(FILE *out) const {
+    for (uint8_t y = 0; y < HEIGHT; y += 2) {
+        for (uint8_t x = 0; x < WIDTH; ++x) {
+            bool top = pixel(x, y), bottom = pixel(x, y + 1);
+            fputc(top && bottom ? '#' : top ? '"' : bottom ? '.' : ' ', out);
+        }
+        fputc('\n', out);
+    }
+}
@@ -0,0 +1,106 @@
+// ssd1306_model.h
+//
+// Behavioural model of the SSD1306 controller on a 128x64 GME12864 module,
+// for host builds. It decodes the I2C control byte (Co, D/C), the command
+// set the driver uses (addressing modes, column/page windows, page-mode
+// pointers, contrast, power, multiplex, timing, scrolling) and keeps the
+// 1 KB GDDRAM, so callers can check what would be on the glass.
+// Scrolling is recorded as configuration only; the model does not animate.
+
+#ifndef SSD1306_MODEL_H
+#define SSD1306_MODEL_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "sim_bus.h"
+
+class SSD1306Model : public SimDevice {
+public:
+    static constexpr uint8_t WIDTH = 128;
+    static constexpr uint8_t HEIGHT = 64;
+    static constexpr uint8_t PAGES = HEIGHT / 8;
+
+    enum Addressing : uint8_t { HORIZONTAL = 0, VERTICAL = 1, PAGE = 2 };
+
+    struct Scroll {
+        uint8_t cmd;           // last setup command: 0x26/0x27/0x29/0x2A, 0 = none
+        uint8_t startPage;
+        uint8_t interval;
+        uint8_t endPage;
+        uint8_t startColumn;   // 0x26/0x27 last two bytes (SSD1306B column range)
+        uint8_t endColumn;
+        uint8_t verticalOffset;
+        uint8_t areaTop;       // 0xA3 vertical scroll area
+        uint8_t areaRows;
+        bool active;
+    };
+
+    SSD1306Model() { reset(); }
+
+    // Power-on reset state (datasheet defaults)
+    void reset();
+
+    // GDDRAM as written (before remap/offset/invert)
+    uint8_t ram(uint8_t page, uint8_t col) const { return ram_[page & 7][col & 0x7F]; }
+    bool pixel(uint8_t x, uint8_t y) const { return (ram(y / 8, x) >> (y & 7)) & 1; }
+
+    // Controller state
+    bool displayOn() const { return displayOn_; }
+    bool chargePump() const { return chargePump_; }
+    bool inverted() const { return inverted_; }
+    bool entireOn() const { return entireOn_; }
+    uint8_t contrast() const { return contrast_; }
+    Addressing addressing() const { return mode_; }
+    uint8_t multiplex() const { return multiplex_; }      // rows - 1
+    uint8_t clockDivide() const { return clockDivide_; }  // 0xD5 argument
+    uint8_t precharge() const { return precharge_; }      // 0xD9 argument
+    uint8_t vcomh() const { return vcomh_; }              // 0xDB argument
+    uint8_t displayOffset() const { return offset_; }
+    uint8_t startLine() const { return startLine_; }
+    uint8_t comPins() const { return comPins_; }
+    const Scroll &scroll() const { return scroll_; }
+
+    // Traffic seen by this device since reset()/clearCounters()
+    uint32_t commandBytes() const { return commandBytes_; }
+    uint32_t dataBytes() const { return dataBytes_; }
+    void clearCounters() { commandBytes_ = dataBytes_ = 0; }
+
+    // ASCII-art dump of GDDRAM, two pixel rows per text line
+    void dump(FILE *out) const;
+
+    // SimDevice
+    void start(bool read) override;
+    bool write(uint8_t b) override;
+
+private:
+    uint8_t ram_[PAGES][WIDTH];
+
+    // Transaction decoding
+    bool expectControl_;
+    bool continuation_;        // Co bit of the last control byte
+    bool dataMode_;            // D/C bit of the last control byte
+
+    // Command decoding (persists across transactions, like the controller)
+    uint8_t cmd_[7];
+    uint8_t cmdLen_;
+    uint8_t cmdNeed_;
+
+    // Address pointers and windows
+    Addressing mode_;
+    uint8_t col_, page_;
+    uint8_t colStart_, colEnd_, pageStart_, pageEnd_;
+
+    bool displayOn_, chargePump_, inverted_, entireOn_;
+    uint8_t contrast_, multiplex_, clockDivide_, precharge_, vcomh_;
+    uint8_t offset_, startLine_, comPins_;
+    Scroll scroll_;
+
+    uint32_t commandBytes_, dataBytes_;
+
+    void command(uint8_t b);
+    void execute();
+    void data(uint8_t b);
+};
+
+#endif // SSD1306_MODEL_H
@@ -1,153 +1,774 @@
 // GME12864_OLED.cpp
 //
 // Minimal I2C-based driver class for a 128x64 GME OLED-like module.
-// Assumes an I2C class with a method having the signature:
-//   bool write(uint8_t address, const uint8_t *data, size_t length);
-// Adapt the I2C calls to your project's I2C API if names/arguments differ.
+// See GME12864_OLED.h for the streaming vs framebuffer render modes.
 //
 // This implementation uses command/data control bytes (0x00 command, 0x40 data)
-// and writes the framebuffer one 128-byte page at a time (8 pages for 64px).
+// and writes the display one page at a time (8 pages for 64px).
 // The init sequence below is basic/typical; adjust to the exact controller
 // (SSD1306/SH1106/etc.) as required.
 
+#include <avr/pgmspace.h>
 #include <stdint.h>
 #include <string.h>
 
+#include "GME12864_OLED.h"
 #include "i2c.h"
+#include "oled_blit.h"
 
-class GME12864_OLED {
-public:
-    static constexpr uint8_t WIDTH  = 128;
-    static constexpr uint8_t HEIGHT = 64;
-    static constexpr uint16_t BUFFER_SIZE = (WIDTH * HEIGHT) / 8;
-
-    GME12864_OLED(uint8_t address = 0x3C)
-        : address_(address) {
-        clear();
-    }
-
-    // Initialize display (basic sequence; adapt for exact controller)
-    bool init() {
-        // A compact init sequence (SSD1306-like). Modify if your controller differs.
-        const uint8_t cmds[] = {
-            0xAE,             // Display OFF
-            0xD5, 0x80,       // Set display clock divide ratio/oscillator frequency
-            0xA8, 0x3F,       // Set multiplex ratio (1 to 64) => 0x3F = 64
-            0xD3, 0x00,       // Set display offset
-            0x40,             // Set start line = 0
-            0x8D, 0x14,       // Charge pump (enable)
-            0x20, 0x00,       // Memory addressing mode: horizontal
-            0xA1,             // Segment remap
-            0xC8,             // COM output scan direction
-            0xDA, 0x12,       // COM pins hardware configuration
-            0x81, 0xCF,       // Contrast
-            0xD9, 0xF1,       // Pre-charge period
-            0xDB, 0x40,       // VCOMH deselect level
-            0xA4,             // Entire display ON resume
-            0xA6,             // Normal display (not inverted)
-            0xAF              // Display ON
-        };
-        if (!sendCommandBlock(cmds, sizeof(cmds))) return false;
-        clear();
-        return update();
-    }
-
-    bool clear() {
-        memset(buffer_, 0x00, sizeof(buffer_));
-        return true;
-    }
-
-    // Draw or clear a single pixel (x: 0..127, y: 0..63)
-    void setPixel(uint8_t x, uint8_t y, bool on) {
-        if (x >= WIDTH || y >= HEIGHT) return;
-        uint16_t byteIndex = (y / 8) * WIDTH + x;
-        uint8_t bit = 1u << (y & 7);
-        if (on) buffer_[byteIndex] |= bit;
-        else    buffer_[byteIndex] &= ~bit;
-    }
-
-    // Write an ASCII string at approximate position using a 5x7 font
-    // (very small helper, not full-featured). Caller must implement mapping if needed.
-    void drawChar5x7(uint8_t x, uint8_t y, char c, bool on);
-    void drawString(uint8_t x, uint8_t y, const char *s);
-
-    // Send framebuffer to display (writes page by page)
-    bool update() {
-        // For each page (8 pages for 64px tall)
-        for (uint8_t page = 0; page < (HEIGHT / 8); ++page) {
-            uint8_t header[] = {
-                0x00, // control byte: command
-                uint8_t(0xB0 | page), // Set page address
-                0x00, // Set lower column start address
-                0x10  // Set higher column start address
-            };
-            if (!I2C::write(address_, header, sizeof(header))) return false;
-
-            // Prepare a local buffer: first byte control (0x40 = data), then 128 bytes of data
-            uint8_t sendBuf[1 + WIDTH];
-            sendBuf[0] = 0x40; // data control byte
-            memcpy(&sendBuf[1], &buffer_[page * WIDTH], WIDTH);
-
-            if (!I2C::write(address_, sendBuf, sizeof(sendBuf))) return false;
+// Rows [r0, r0 + 8) of one decoded canvas column as a page byte. Rows
+// outside the canvas read as 0; r0 may be negative when the canvas starts
+// below the page.
+static uint8_t canvasByte(const uint8_t *column, uint8_t pages, int8_t r0) {
+    int8_t pg = r0 >> 3; // floor, also for negative r0
+    uint8_t sh = r0 & 7;
+    uint8_t lo = (pg >= 0 && pg < pages) ? column[pg] : 0;
+    if (!sh) return lo;
+    ++pg;
+    uint8_t hi = (pg >= 0 && pg < pages) ? column[pg] : 0;
+    return uint8_t(lo >> sh) | uint8_t(hi << (8 - sh));
+}
+
+// Bits of a page byte covered by canvas rows [0, h) when the page starts at
+// canvas row r0.
+static uint8_t coverMask(uint8_t h, int8_t r0) {
+    int16_t top = r0 < 0 ? -r0 : 0;
+    int16_t bot = int16_t(h) - r0;
+    if (bot > 8) bot = 8;
+    if (top >= bot) return 0;
+    return uint8_t(0xFF << top) & uint8_t(0xFF >> (8 - bot));
+}
+
+// Place a box given in canvas coordinates on the screen at region `r`,
+// clipped to the region. Width/height 0 when nothing is left.
+static region placeArea(const region &r, const region &box) {
+    region a = { uint8_t(r.x + box.x), uint8_t(r.y + box.y), 0, 0 };
+    if (box.x < r.width) a.width = box.width < r.width - box.x ? box.width : r.width - box.x;
+    if (box.y < r.height) a.height = box.height < r.height - box.y ? box.height : r.height - box.y;
+    return a;
+}
+
+// The screen area of canvas `c` shown at region `r` that holds set pixels
+// (its ink), clipped to the region.
+static region inkArea(const region &r, const oled_canvas &c) {
+    if (!c.ink.width) return placeArea(r, { 0, 0, c.width, c.height });
+    return placeArea(r, c.ink);
+}
+
+// A canvas-relative transition window as a canvas-coordinate box
+static region windowBox(const oled_window &w) {
+    return { w.x0, uint8_t(w.p0 * 8), uint8_t(w.x1 - w.x0 + 1), uint8_t((w.p1 - w.p0 + 1) * 8) };
+}
+
+// Bounding box of two areas; an empty one does not count.
+static region unite(const region &a, const region &b) {
+    if (!a.width || !a.height) return b;
+    if (!b.width || !b.height) return a;
+    uint8_t x0 = a.x < b.x ? a.x : b.x;
+    uint8_t y0 = a.y < b.y ? a.y : b.y;
+    uint8_t x1 = a.x + a.width > b.x + b.width ? a.x + a.width : b.x + b.width;
+    uint8_t y1 = a.y + a.height > b.y + b.height ? a.y + a.height : b.y + b.height;
+    return { x0, y0, uint8_t(x1 - x0), uint8_t(y1 - y0) };
+}
+
+// A compact init sequence (SSD1306-like). Modify if your controller differs.
+// Kept in flash and sent as a single command transaction.
+static const uint8_t initCmds[] PROGMEM = {
+    0xAE,             // Display OFF
+    0xD5, 0x80,       // Set display clock divide ratio/oscillator frequency
+    0xA8, 0x3F,       // Set multiplex ratio (1 to 64) => 0x3F = 64
+    0xD3, 0x00,       // Set display offset
+    0x40,             // Set start line = 0
+    0x8D, 0x14,       // Charge pump (enable)
+    0x20, 0x00,       // Memory addressing mode: horizontal (see mode_)
+    0xA1,             // Segment remap
+    0xC8,             // COM output scan direction
+    0xDA, 0x12,       // COM pins hardware configuration
+    0x81, 0xCF,       // Contrast
+    0xD9, 0xF1,       // Pre-charge period
+    0xDB, 0x40,       // VCOMH deselect level
+    0xA4,             // Entire display ON resume
+    0xA6,             // Normal display (not inverted)
+    0xAF              // Display ON
+};
+
+bool GME12864_OLED::init() {
+    if (!sendCommands_P(initCmds, sizeof(initCmds))) return false;
+    mode_ = ADDR_HORIZONTAL;
+    rowFirst_ = 0;
+    rowCount_ = HEIGHT;
+    clear();
+    return update();
+}
+
+// A clean page has dirtyLo_ = 0xFF > dirtyHi_ = 0, so plain min/max merging
+// works for clean and dirty pages alike.
+void GME12864_OLED::markDirty(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+    if (x >= WIDTH || y >= HEIGHT || !w || !h) return;
+    uint8_t x1 = (w > WIDTH - x) ? WIDTH - 1 : x + w - 1;
+    uint8_t p1 = (h > HEIGHT - y) ? PAGES - 1 : (y + h - 1) / 8;
+    for (uint8_t page = y / 8; page <= p1; ++page) {
+        if (x < dirtyLo_[page]) dirtyLo_[page] = x;
+        if (x1 > dirtyHi_[page]) dirtyHi_[page] = x1;
+    }
+}
+
+// Addressing mode matching flushWindow()'s byte order: the framebuffer is
+// column-major already, while the scene is composed one page strip at a time.
+static constexpr GME12864_OLED::Addressing FLUSH_MODE =
+    OLED_FRAMEBUFFER ? GME12864_OLED::ADDR_VERTICAL : GME12864_OLED::ADDR_HORIZONTAL;
+
+bool GME12864_OLED::update() {
+    return beginFlush() && step(0xFFFF);
+}
+
+bool GME12864_OLED::beginFlush() {
+    return stopScroll();
+}
+
+bool GME12864_OLED::done() const {
+    for (uint8_t page = 0; page < PAGES; ++page) {
+        if (dirtyLo_[page] <= dirtyHi_[page]) return false;
+    }
+    return true;
+}
+
+// Flush dirty spans until `budget` data bytes went out. Runs of pages with
+// the same span share one column/page window, so a changed 28x64 digit is
+// one window command and 224 data bytes. A run that does not fit is cut at
+// a column (down to a single page if need be): its leading columns go out
+// and the spans shrink to the rest, which the next step() picks up. Spans
+// are only marked clean once they reached the panel.
+bool GME12864_OLED::step(uint16_t budget) {
+    uint8_t page = 0;
+    while (page < PAGES && budget) {
+        uint8_t lo = dirtyLo_[page];
+        uint8_t hi = dirtyHi_[page];
+        if (lo > hi) {
+            ++page;
+            continue;
+        }
+        uint8_t last = page;
+        while (last + 1 < PAGES && dirtyLo_[last + 1] == lo && dirtyHi_[last + 1] == hi) ++last;
+
+        uint8_t pages = last - page + 1;
+        uint8_t cols = hi - lo + 1;
+        if (uint16_t(cols) * pages > budget) {
+            if (budget < pages) {
+                last = page;
+                pages = 1;
+            }
+            if (uint16_t(cols) * pages > budget) cols = budget / pages;
+        }
+        uint8_t x1 = lo + cols - 1;
+
+        if (!setWindow(lo, x1, page, last, FLUSH_MODE)) return false;
+        if (!flushWindow(lo, x1, page, last)) return false;
+        budget -= uint16_t(cols) * pages;
+
+        for (; page <= last; ++page) {
+            if (x1 == hi) {
+                dirtyLo_[page] = 0xFF;
+                dirtyHi_[page] = 0;
+            } else {
+                dirtyLo_[page] = x1 + 1;
+            }
+        }
+    }
+    return true;
+}
+
+#if OLED_FRAMEBUFFER
+
+bool GME12864_OLED::clear() {
+    memset(buffer_, 0x00, sizeof(buffer_));
+    invalidate();
+    return true;
+}
+
+void GME12864_OLED::drawCanvas(const region *at, const oled_canvas *canvas) {
+    region r;
+    memcpy_P(&r, at, sizeof(r));
+    const oled_target screen = { buffer_, 0, WIDTH, 0, PAGES };
+    oled_blit_canvas(screen, r.x, r.y, canvas, r.width);
+    markDirty(r.x, r.y, r.width, r.height);
+}
+
+// Stream the window straight out of the framebuffer. Vertical addressing
+// fills it column by column, the buffer's own order.
+bool GME12864_OLED::flushWindow(uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1) {
+    bool ok = I2C::beginWrite(address_) && I2C::put(0x40); // data control byte
+    for (uint8_t x = x0; ok && x <= x1; ++x) {
+        const uint8_t *src = &buffer_[x * PAGES + p0];
+        for (uint8_t page = p0; ok && page <= p1; ++page) {
+            ok = I2C::put(*src++);
         }
-        return true;
     }
+    I2C::end();
+    return ok;
+}
+
+#else
+
+bool GME12864_OLED::clear() {
+    setScene(nullptr, 0);
+    invalidate();
+    return true;
+}
+
+// Only the ink of the outgoing and incoming canvases has to be redrawn:
+// everywhere else both are blank.
+void GME12864_OLED::setScene(SceneItem *items, uint8_t count) {
+    for (uint8_t i = 0; i < sceneCount_; ++i) markInk(scene_[i]);
+    scene_ = items;
+    sceneCount_ = count;
+    for (uint8_t i = 0; i < sceneCount_; ++i) markInk(scene_[i]);
+}
+
+void GME12864_OLED::setCanvas(uint8_t index, const oled_canvas *canvas) {
+    if (index >= sceneCount_ || scene_[index].canvas == canvas) return;
+    const oled_transition *t = findTransition(scene_[index].canvas, canvas);
+    if (t) {
+        region r;
+        memcpy_P(&r, scene_[index].at, sizeof(r));
+        uint8_t count = pgm_read_byte(&t->count);
+        const oled_window *windows = (const oled_window *)pgm_read_ptr(&t->windows);
+        for (uint8_t i = 0; i < count; ++i) {
+            oled_window w;
+            memcpy_P(&w, &windows[i], sizeof(w));
+            region a = placeArea(r, windowBox(w));
+            markDirty(a.x, a.y, a.width, a.height);
+        }
+        scene_[index].canvas = canvas;
+        return;
+    }
+    markInk(scene_[index]);
+    scene_[index].canvas = canvas;
+    markInk(scene_[index]);
+}
 
-    bool setContrast(uint8_t contrast) {
-        uint8_t cmds[] = { 0x81, contrast };
-        return sendCommandBlock(cmds, sizeof(cmds));
+void GME12864_OLED::markInk(const SceneItem &item) {
+    region r;
+    oled_canvas c;
+    memcpy_P(&r, item.at, sizeof(r));
+    memcpy_P(&c, item.canvas, sizeof(c));
+    region a = inkArea(r, c);
+    markDirty(a.x, a.y, a.width, a.height);
+}
+
+// Render the window from the scene. Each page is composed OLED_STRIP_WIDTH
+// columns at a time; consecutive data transfers continue where the previous
+// one stopped, so the window only has to be set once.
+#if OLED_PIPELINE
+
+static_assert(I2C_ASYNC, "OLED_PIPELINE needs an I2C backend with writeAsync()");
+static_assert(I2C_QUEUE_LEN >= 4, "OLED_PIPELINE keeps two transfers queued");
+
+static volatile bool stripFailed;
+
+static void stripSent(bool ok) {
+    if (!ok) stripFailed = true;
+}
+
+// Ping-pong: strip n is composed into buffer n % 2 while strip n - 1 is
+// still on the bus. I2C::flush(1) first waits out strip n - 2, the last
+// user of that buffer. Everything has gone out (or failed) on return, as
+// the buffers live on this stack frame.
+bool GME12864_OLED::flushWindow(uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1) {
+    uint8_t strips[2][1 + OLED_STRIP_WIDTH];
+    uint8_t n = 0;
+    stripFailed = false;
+    for (uint8_t page = p0; !stripFailed && page <= p1; ++page) {
+        for (uint16_t x = x0; !stripFailed && x <= x1; x += OLED_STRIP_WIDTH) {
+            uint8_t w = (x1 - x + 1 < OLED_STRIP_WIDTH) ? x1 - x + 1 : OLED_STRIP_WIDTH;
+            uint8_t *strip = strips[n++ & 1];
+            I2C::flush(1);
+            strip[0] = 0x40; // data control byte
+            composeStrip(&strip[1], uint8_t(x), w, page);
+            if (!I2C::writeAsync(address_, strip, 1 + w, stripSent)) stripFailed = true;
+        }
     }
+    I2C::flush();
+    return !stripFailed;
+}
 
-    bool power(bool on) {
-        uint8_t cmd = on ? 0xAF : 0xAE;
-        return sendCommand(cmd);
+#else
+
+bool GME12864_OLED::flushWindow(uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1) {
+    uint8_t strip[1 + OLED_STRIP_WIDTH];
+    strip[0] = 0x40; // data control byte
+    for (uint8_t page = p0; page <= p1; ++page) {
+        for (uint16_t x = x0; x <= x1; x += OLED_STRIP_WIDTH) {
+            uint8_t w = (x1 - x + 1 < OLED_STRIP_WIDTH) ? x1 - x + 1 : OLED_STRIP_WIDTH;
+            composeStrip(&strip[1], uint8_t(x), w, page);
+            if (!I2C::write(address_, strip, 1 + w)) return false;
+        }
     }
+    return true;
+}
 
-private:
-    uint8_t address_;
-    uint8_t buffer_[BUFFER_SIZE];
+#endif // OLED_PIPELINE
 
-    bool sendCommand(uint8_t cmd) {
-        uint8_t data[2] = { 0x00, cmd }; // 0x00 = control byte for command
-        return I2C::write(address_, data, 2);
+void GME12864_OLED::composeStrip(uint8_t *dst, uint8_t x0, uint8_t w, uint8_t page) const {
+    memset(dst, 0x00, w);
+    const oled_target strip = { dst, x0, w, page, 1 };
+    for (uint8_t i = 0; i < sceneCount_; ++i) {
+        region r;
+        memcpy_P(&r, scene_[i].at, sizeof(r));
+        oled_blit_canvas(strip, r.x, r.y, scene_[i].canvas, r.width);
     }
+}
 
-    bool sendCommandBlock(const uint8_t *cmds, size_t len) {
-        // For simplicity send as a sequence of [0x00, cmd] pairs.
-        // Some controllers let you send many commands in one packet with a single 0x00 prefix,
-        // adapt if your I2C implementation/controller prefers different packing.
-        for (size_t i = 0; i < len; ++i) {
-            if (!sendCommand(cmds[i])) return false;
+#endif // OLED_FRAMEBUFFER
+
+// Send w columns of a canvas, starting at the source's current column, into
+// an open data transfer, each decoded into SRAM and re-cut to the window's
+// pages p0..p1 (canvas top at screen row y, rows from h down cleared).
+template<typename Source>
+static bool blitColumns(Source src, uint8_t w, uint8_t pages,
+                        uint8_t p0, uint8_t p1, uint8_t y, uint8_t h) {
+    uint8_t column[256 / 8];
+    bool ok = true;
+    for (uint8_t x = 0; ok && x < w; ++x, src.next()) {
+        src.column(column);
+        for (uint8_t page = p0; ok && page <= p1; ++page) {
+            int8_t r0 = int8_t(page * 8 - y);
+            ok = I2C::put(canvasByte(column, pages, r0) & coverMask(h, r0));
         }
-        return true;
     }
+    return ok;
+}
+
+// Stream a canvas from PROGMEM straight into I2C data transfers. A
+// column/page window is set first, so the controller places the bytes and
+// the wire carries exactly the window's bytes: the whole region, or with
+// `previous` only the windows where the two canvases differ (from the
+// transition table) or else the ink of both.
+bool GME12864_OLED::blit(const region *at, const oled_canvas *canvas, const oled_canvas *previous) {
+    region r;
+    oled_canvas c;
+    memcpy_P(&r, at, sizeof(r));
+    memcpy_P(&c, canvas, sizeof(c));
+    if (r.x >= WIDTH || r.y >= HEIGHT) return true;
+
+    uint8_t h = c.height < r.height ? c.height : r.height;
+    if (h > HEIGHT - r.y) h = HEIGHT - r.y;
+    if (!previous) {
+        return sendArea(r, c, h, { r.x, r.y, c.width < r.width ? c.width : r.width, h });
+    }
+
+    const oled_transition *t = findTransition(previous, canvas);
+    if (t) {
+        uint8_t count = pgm_read_byte(&t->count);
+        const oled_window *windows = (const oled_window *)pgm_read_ptr(&t->windows);
+        bool ok = true;
+        for (uint8_t i = 0; ok && i < count; ++i) {
+            oled_window w;
+            memcpy_P(&w, &windows[i], sizeof(w));
+            ok = sendArea(r, c, h, placeArea(r, windowBox(w)));
+        }
+        return ok;
+    }
+
+    oled_canvas prev;
+    memcpy_P(&prev, previous, sizeof(prev));
+    return sendArea(r, c, h, unite(inkArea(r, c), inkArea(r, prev)));
+}
+
+// Send screen area `a` of canvas `c` shown at region `r`, whose visible
+// height is `h`. Rows of the touched pages outside the region (unaligned
+// y/height) are cleared.
+bool GME12864_OLED::sendArea(const region &r, const oled_canvas &c, uint8_t h, region a) {
+    if (a.width > WIDTH - a.x) a.width = WIDTH - a.x;
+    if (a.height > r.y + h - a.y) a.height = r.y + h - a.y;
+    if (!a.width || !a.height) return true;
+
+    const uint8_t cx0 = a.x - r.x;
+    const uint8_t p0 = a.y / 8;
+    const uint8_t p1 = (a.y + a.height - 1) / 8;
+    if (!setWindow(a.x, a.x + a.width - 1, p0, p1, ADDR_VERTICAL)) return false;
+
+    // Vertical addressing fills the window column by column, which is the
+    // canvas' own byte order: a page-aligned canvas sent with all its pages
+    // from its first column goes out as one PROGMEM burst (raw) or is
+    // expanded byte by byte as it is sent (page mask). Anything else is
+    // decoded a column at a time. The bench's blit_digit and
+    // blit_digit_shifted scenarios time one of each.
+    const uint8_t pages = c.height / 8;
+    bool ok = I2C::beginWrite(address_) && I2C::put(0x40);
+    if (ok && !(r.y & 7) && !cx0 && p0 == r.y / 8 && p1 - p0 + 1 == pages) {
+        if (c.encoding == OLED_ENC_PAGEMASK) {
+            const uint8_t *mask = c.data;
+            const uint8_t *src = c.data + c.width;
+            for (uint8_t x = 0; ok && x < a.width; ++x) {
+                uint8_t m = pgm_read_byte(mask++);
+                for (uint8_t page = 0; ok && page < pages; ++page, m >>= 1) {
+                    ok = I2C::put((m & 1) ? pgm_read_byte(src++) : 0);
+                }
+            }
+        } else {
+            const uint8_t *src = c.data;
+            for (uint16_t n = uint16_t(a.width) * pages; ok && n; --n) {
+                ok = I2C::put(pgm_read_byte(src++));
+            }
+        }
+    } else if (ok) {
+        if (c.encoding == OLED_ENC_PAGEMASK) {
+            oled_pagemask_source src(c.data, c.width, pages);
+            src.seek(cx0);
+            ok = blitColumns(src, a.width, pages, p0, p1, r.y, h);
+        } else {
+            oled_raw_source src = { c.data, pages };
+            src.seek(cx0);
+            ok = blitColumns(src, a.width, pages, p0, p1, r.y, h);
+        }
+    }
+    I2C::end();
+    return ok;
+}
+
+// The table entry for going from one canvas to another, or nullptr
+const oled_transition *GME12864_OLED::findTransition(const oled_canvas *from, const oled_canvas *to) const {
+    for (uint8_t i = 0; i < transitionCount_; ++i) {
+        const oled_transition *t = &transitions_[i];
+        if (pgm_read_ptr(&t->from) == from && pgm_read_ptr(&t->to) == to) return t;
+    }
+    return nullptr;
+}
+
+// Set the column/page window, switching the addressing mode in the same
+// transaction when it differs from the one last programmed.
+bool GME12864_OLED::setWindow(uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1, Addressing mode) {
+    bool ok = beginCommands();
+    if (ok && scrolled_.width) {
+        ok = command(0x2E);                   // no RAM writes while scrolling
+        if (ok) resync();
+    }
+    if (ok && mode != mode_) {
+        ok = command(0x20, mode);             // Memory addressing mode
+        if (ok) mode_ = mode;
+    }
+    ok = ok
+        && command(0x21, x0) && command(x1)   // Column address window
+        && command(0x22, p0) && command(p1);  // Page address window
+    return endCommands(ok);
+}
+
+// 0xD5, 0x81, 0xD9, 0xDB arguments per profile. Bright is what initCmds
+// programs; normal goes back to the reset defaults for pre-charge and VCOMH
+// (0.77 Vcc); dim runs the slowest oscillator, one-clock pre-charge phases
+// and 0.65 Vcc VCOMH at minimum contrast.
+static const uint8_t profileArgs[][4] PROGMEM = {
+    { 0x80, 0xCF, 0xF1, 0x40 }, // POWER_BRIGHT
+    { 0x80, 0x7F, 0x22, 0x20 }, // POWER_NORMAL
+    { 0x00, 0x01, 0x11, 0x00 }, // POWER_DIM
 };
 
-// --- Minimal 5x7 font (only chars 32..127) ---
-// Provide your own font table or expand as needed.
-// For brevity this is a placeholder: implement proper font data to use drawChar5x7/drawString.
-static const uint8_t font5x7_basic[96][5] = {
-    // All zeros -> blank. User should fill this table with real 5-byte glyphs.
-    // Example for space and '!' (if desired) can be inserted here.
+void GME12864_OLED::setUsedRows(uint8_t first, uint8_t count) {
+    if (first >= HEIGHT || !count) return;
+    if (count > HEIGHT - first) count = HEIGHT - first;
+    if (count < MIN_ROWS) {
+        uint8_t grow = (MIN_ROWS - count) / 2;
+        first = first > grow ? first - grow : 0;
+        if (first > HEIGHT - MIN_ROWS) first = HEIGHT - MIN_ROWS;
+        count = MIN_ROWS;
+    }
+    rowFirst_ = first;
+    rowCount_ = count;
+}
+
+bool GME12864_OLED::setPowerProfile(PowerProfile profile) {
+    if (profile == POWER_OFF) {
+        return endCommands(beginCommands() && command(0xAE) && command(0x8D, 0x10));
+    }
+    // With the COM scan remapped (0xC8) row r of the start line goes out on
+    // COM(mux - 1 - r) shifted by the offset; (first + count) % 64 puts RAM
+    // row `first` on the COM it has at full multiplex.
+    const uint8_t *args = profileArgs[profile];
+    bool ok = beginCommands()
+        && command(0xD5, pgm_read_byte(&args[0]))
+        && command(0x81, pgm_read_byte(&args[1]))
+        && command(0xD9, pgm_read_byte(&args[2]))
+        && command(0xDB, pgm_read_byte(&args[3]))
+        && command(0xA8, rowCount_ - 1)
+        && command(0xD3, (rowFirst_ + rowCount_) & 0x3F)
+        && command(0x40 | rowFirst_)
+        && command(0x8D, 0x14)
+        && command(0xAF);
+    return endCommands(ok);
+}
+
+// Scroll setup per the datasheet: deactivate (0x2E) before changing the
+// setup, then the optional vertical area, the setup and activate (0x2F),
+// all in one command transaction. A scroll already running is replaced.
+bool GME12864_OLED::startScroll(const region *at, ScrollDirection dir,
+                                ScrollInterval interval, uint8_t rowsPerStep) {
+    region r;
+    memcpy_P(&r, at, sizeof(r));
+    if (r.x >= WIDTH || r.y >= HEIGHT || !r.width || !r.height) return stopScroll();
+    uint8_t w = r.width < WIDTH - r.x ? r.width : WIDTH - r.x;
+    uint8_t h = r.height < HEIGHT - r.y ? r.height : HEIGHT - r.y;
+    uint8_t p0 = r.y / 8;
+    uint8_t p1 = (r.y + h - 1) / 8;
+    bool vertical = dir == SCROLL_UP_RIGHT || dir == SCROLL_UP_LEFT;
+
+    region area = { 0, uint8_t(p0 * 8), WIDTH, uint8_t((p1 - p0 + 1) * 8) };
+    if (OLED_SCROLL_COLUMNS && !vertical) {
+        area.x = r.x;
+        area.width = w;
+    }
+
+    bool ok = beginCommands() && command(0x2E);
+    if (ok && vertical) ok = command(0xA3, r.y) && command(h);
+    ok = ok && command(dir, 0x00) && command(p0, interval) && command(p1);
+    if (vertical) {
+        ok = ok && command(rowsPerStep & 0x3F);
+    } else if (OLED_SCROLL_COLUMNS) {
+        ok = ok && command(r.x, r.x + w - 1);
+    } else {
+        ok = ok && command(0x00, 0xFF);
+    }
+    ok = ok && command(0x2F);
+
+    // The old scroll stopped; whether the new one started or not, its area
+    // is only trusted again after a redraw.
+    resync();
+    scrolled_ = area;
+    return endCommands(ok);
+}
+
+bool GME12864_OLED::stopScroll() {
+    if (!scrolled_.width) return true;
+    if (!endCommands(beginCommands() && command(0x2E))) return false;
+    resync();
+    return true;
+}
+
+// After a scroll the RAM under it is rotated: redraw it on the next update()
+void GME12864_OLED::resync() {
+    markDirty(scrolled_.x, scrolled_.y, scrolled_.width, scrolled_.height);
+    scrolled_.width = 0;
+}
+
+// Command stream. A single control byte with Co = 0 marks every following
+// byte of the transaction as a command, so a run of commands costs one
+// START/address/STOP. (Co = 1 pairs are only needed to mix commands and data
+// in one transaction, and cost an extra byte per command.)
+
+bool GME12864_OLED::beginCommands() {
+    return I2C::beginWrite(address_) && I2C::put(0x00); // control byte: command
+}
+
+bool GME12864_OLED::command(uint8_t cmd) {
+    return I2C::put(cmd);
+}
+
+bool GME12864_OLED::command(uint8_t cmd, uint8_t arg) {
+    return I2C::put(cmd) && I2C::put(arg);
+}
+
+bool GME12864_OLED::endCommands(bool ok) {
+    I2C::end();
+    return ok;
+}
+
+bool GME12864_OLED::sendCommands(const uint8_t *cmds, uint8_t len) {
+    bool ok = beginCommands();
+    for (uint8_t i = 0; ok && i < len; ++i) {
+        ok = command(cmds[i]);
+    }
+    return endCommands(ok);
+}
+
+bool GME12864_OLED::sendCommands_P(const uint8_t *cmds, uint8_t len) {
+    bool ok = beginCommands();
+    for (uint8_t i = 0; ok && i < len; ++i) {
+        ok = command(pgm_read_byte(cmds + i));
+    }
+    return endCommands(ok);
+}
+
+// --- 5x7 font, ASCII 32..126 ---
+// Five column bytes per glyph, LSB = top row, row 7 always blank.
+static constexpr uint8_t FONT_FIRST  = 32;
+static constexpr uint8_t FONT_GLYPHS = 95;
+static constexpr uint8_t FONT_ADVANCE = 6; // 5 pixels + 1 space
+
+static const uint8_t font5x7[FONT_GLYPHS * 5] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00,  // space
+    0x00, 0x00, 0x5F, 0x00, 0x00,  // !
+    0x00, 0x07, 0x00, 0x07, 0x00,  // "
+    0x14, 0x7F, 0x14, 0x7F, 0x14,  // #
+    0x24, 0x2A, 0x7F, 0x2A, 0x12,  // $
+    0x23, 0x13, 0x08, 0x64, 0x62,  // %
+    0x36, 0x49, 0x55, 0x22, 0x50,  // &
+    0x00, 0x05, 0x03, 0x00, 0x00,  // '
+    0x00, 0x1C, 0x22, 0x41, 0x00,  // (
+    0x00, 0x41, 0x22, 0x1C, 0x00,  // )
+    0x08, 0x2A, 0x1C, 0x2A, 0x08,  // *
+    0x08, 0x08, 0x3E, 0x08, 0x08,  // +
+    0x00, 0x50, 0x30, 0x00, 0x00,  // ,
+    0x08, 0x08, 0x08, 0x08, 0x08,  // -
+    0x00, 0x60, 0x60, 0x00, 0x00,  // .
+    0x20, 0x10, 0x08, 0x04, 0x02,  // /
+    0x3E, 0x51, 0x49, 0x45, 0x3E,  // 0
+    0x00, 0x42, 0x7F, 0x40, 0x00,  // 1
+    0x42, 0x61, 0x51, 0x49, 0x46,  // 2
+    0x21, 0x41, 0x45, 0x4B, 0x31,  // 3
+    0x18, 0x14, 0x12, 0x7F, 0x10,  // 4
+    0x27, 0x45, 0x45, 0x45, 0x39,  // 5
+    0x3C, 0x4A, 0x49, 0x49, 0x30,  // 6
+    0x01, 0x71, 0x09, 0x05, 0x03,  // 7
+    0x36, 0x49, 0x49, 0x49, 0x36,  // 8
+    0x06, 0x49, 0x49, 0x29, 0x1E,  // 9
+    0x00, 0x36, 0x36, 0x00, 0x00,  // :
+    0x00, 0x56, 0x36, 0x00, 0x00,  // ;
+    0x08, 0x14, 0x22, 0x41, 0x00,  // <
+    0x14, 0x14, 0x14, 0x14, 0x14,  // =
+    0x00, 0x41, 0x22, 0x14, 0x08,  // >
+    0x02, 0x01, 0x51, 0x09, 0x06,  // ?
+    0x32, 0x49, 0x79, 0x41, 0x3E,  // @
+    0x7E, 0x11, 0x11, 0x11, 0x7E,  // A
+    0x7F, 0x49, 0x49, 0x49, 0x36,  // B
+    0x3E, 0x41, 0x41, 0x41, 0x22,  // C
+    0x7F, 0x41, 0x41, 0x22, 0x1C,  // D
+    0x7F, 0x49, 0x49, 0x49, 0x41,  // E
+    0x7F, 0x09, 0x09, 0x09, 0x01,  // F
+    0x3E, 0x41, 0x49, 0x49, 0x7A,  // G
+    0x7F, 0x08, 0x08, 0x08, 0x7F,  // H
+    0x00, 0x41, 0x7F, 0x41, 0x00,  // I
+    0x20, 0x40, 0x41, 0x3F, 0x01,  // J
+    0x7F, 0x08, 0x14, 0x22, 0x41,  // K
+    0x7F, 0x40, 0x40, 0x40, 0x40,  // L
+    0x7F, 0x02, 0x0C, 0x02, 0x7F,  // M
+    0x7F, 0x04, 0x08, 0x10, 0x7F,  // N
+    0x3E, 0x41, 0x41, 0x41, 0x3E,  // O
+    0x7F, 0x09, 0x09, 0x09, 0x06,  // P
+    0x3E, 0x41, 0x51, 0x21, 0x5E,  // Q
+    0x7F, 0x09, 0x19, 0x29, 0x46,  // R
+    0x46, 0x49, 0x49, 0x49, 0x31,  // S
+    0x01, 0x01, 0x7F, 0x01, 0x01,  // T
+    0x3F, 0x40, 0x40, 0x40, 0x3F,  // U
+    0x1F, 0x20, 0x40, 0x20, 0x1F,  // V
+    0x3F, 0x40, 0x38, 0x40, 0x3F,  // W
+    0x63, 0x14, 0x08, 0x14, 0x63,  // X
+    0x07, 0x08, 0x70, 0x08, 0x07,  // Y
+    0x61, 0x51, 0x49, 0x45, 0x43,  // Z
+    0x00, 0x7F, 0x41, 0x41, 0x00,  // [
+    0x02, 0x04, 0x08, 0x10, 0x20,  // backslash
+    0x00, 0x41, 0x41, 0x7F, 0x00,  // ]
+    0x04, 0x02, 0x01, 0x02, 0x04,  // ^
+    0x40, 0x40, 0x40, 0x40, 0x40,  // _
+    0x00, 0x01, 0x02, 0x04, 0x00,  // `
+    0x20, 0x54, 0x54, 0x54, 0x78,  // a
+    0x7F, 0x48, 0x44, 0x44, 0x38,  // b
+    0x38, 0x44, 0x44, 0x44, 0x20,  // c
+    0x38, 0x44, 0x44, 0x48, 0x7F,  // d
+    0x38, 0x54, 0x54, 0x54, 0x18,  // e
+    0x08, 0x7E, 0x09, 0x01, 0x02,  // f
+    0x0C, 0x52, 0x52, 0x52, 0x3E,  // g
+    0x7F, 0x08, 0x04, 0x04, 0x78,  // h
+    0x00, 0x44, 0x7D, 0x40, 0x00,  // i
+    0x20, 0x40, 0x44, 0x3D, 0x00,  // j
+    0x7F, 0x10, 0x28, 0x44, 0x00,  // k
+    0x00, 0x41, 0x7F, 0x40, 0x00,  // l
+    0x7C, 0x04, 0x18, 0x04, 0x78,  // m
+    0x7C, 0x08, 0x04, 0x04, 0x78,  // n
+    0x38, 0x44, 0x44, 0x44, 0x38,  // o
+    0x7C, 0x14, 0x14, 0x14, 0x08,  // p
+    0x08, 0x14, 0x14, 0x18, 0x7C,  // q
+    0x7C, 0x08, 0x04, 0x04, 0x08,  // r
+    0x48, 0x54, 0x54, 0x54, 0x20,  // s
+    0x04, 0x3F, 0x44, 0x40, 0x20,  // t
+    0x3C, 0x40, 0x40, 0x20, 0x7C,  // u
+    0x1C, 0x20, 0x40, 0x20, 0x1C,  // v
+    0x3C, 0x40, 0x30, 0x40, 0x3C,  // w
+    0x44, 0x28, 0x10, 0x28, 0x44,  // x
+    0x0C, 0x50, 0x50, 0x50, 0x3C,  // y
+    0x44, 0x64, 0x54, 0x4C, 0x44,  // z
+    0x00, 0x08, 0x36, 0x41, 0x00,  // {
+    0x00, 0x00, 0x7F, 0x00, 0x00,  // |
+    0x00, 0x41, 0x36, 0x08, 0x00,  // }
+    0x08, 0x04, 0x08, 0x10, 0x08,  // ~
 };
 
+// PROGMEM pointer to a glyph; characters outside the table draw as '?'.
+static const uint8_t *glyph5x7(char c) {
+    uint8_t i = uint8_t(c) - FONT_FIRST;
+    if (i >= FONT_GLYPHS) i = '?' - FONT_FIRST;
+    return font5x7 + i * 5;
+}
+
+#if OLED_FRAMEBUFFER
+
+// Glyph rows 0..6 are drawn opaque (set pixels `on`, the rest `!on`); row 7
+// and everything else is left alone. Page-aligned y writes the five column
+// bytes directly; otherwise each column is shifted across two pages.
 void GME12864_OLED::drawChar5x7(uint8_t x, uint8_t y, char c, bool on) {
-    if (c < 32 || c > 127) return;
-    const uint8_t *glyph = font5x7_basic[c - 32];
-    for (uint8_t col = 0; col < 5; ++col) {
-        uint8_t colByte = glyph[col];
-        for (uint8_t row = 0; row < 7; ++row) {
-            bool pixelOn = (colByte >> row) & 1;
-            setPixel(x + col, y + row, pixelOn ? on : !on);
+    if (x >= WIDTH || y >= HEIGHT) return;
+    const uint8_t *glyph = glyph5x7(c);
+    const uint8_t sh = y & 7;
+    const uint8_t page = y / 8;
+    const uint8_t loMask = uint8_t(0x7F << sh);
+    const uint8_t hiMask = uint8_t(0x7F >> (8 - sh));
+    uint8_t cols = WIDTH - x < 5 ? WIDTH - x : 5;
+    uint8_t *dst = &buffer_[x * PAGES + page];
+    for (uint8_t col = 0; col < cols; ++col, dst += PAGES) {
+        uint8_t bits = pgm_read_byte(glyph + col);
+        if (!on) bits = ~bits & 0x7F;
+        dst[0] = (dst[0] & ~loMask) | uint8_t(bits << sh);
+        if (sh > 1 && page + 1 < PAGES) {
+            dst[1] = (dst[1] & ~hiMask) | uint8_t(bits >> (8 - sh));
         }
     }
+    markDirty(x, y, cols, 7);
 }
 
 void GME12864_OLED::drawString(uint8_t x, uint8_t y, const char *s) {
     while (*s) {
         drawChar5x7(x, y, *s, true);
-        x += 6; // 5 pixels + 1 space
+        x += FONT_ADVANCE;
         ++s;
         if (x + 5 >= WIDTH) break;
     }
-}
\ No newline at end of file
+}
+
+#else
+
+// Text goes straight to the panel: one window covering the whole string and
+// one data transfer for all of it, FONT_ADVANCE bytes per character (two per
+// column when y is not page-aligned). Rows of the window outside the glyphs
+// are cleared, so keep text clear of scene items. Characters that do not fit
+// the panel are dropped.
+bool GME12864_OLED::drawString(uint8_t x, uint8_t y, const char *s, bool on) {
+    if (x >= WIDTH || y >= HEIGHT) return true;
+    uint8_t fit = (WIDTH - x + 1) / FONT_ADVANCE;
+    size_t n = strlen(s);
+    uint8_t len = n < fit ? uint8_t(n) : fit;
+    if (!len) return true;
+
+    const uint8_t sh = y & 7;
+    const uint8_t p0 = y / 8;
+    const uint8_t p1 = (sh > 1 && p0 + 1 < PAGES) ? p0 + 1 : p0;
+    uint8_t w = len * FONT_ADVANCE;
+    if (w > WIDTH - x) w = WIDTH - x;
+    if (!setWindow(x, x + w - 1, p0, p1, ADDR_VERTICAL)) return false;
+
+    bool ok = I2C::beginWrite(address_) && I2C::put(0x40);
+    for (uint8_t col = 0; ok && col < w; ++col) {
+        uint8_t cell = col % FONT_ADVANCE;
+        uint8_t bits = (cell < 5) ? pgm_read_byte(glyph5x7(s[col / FONT_ADVANCE]) + cell) : 0;
+        if (!on) bits = ~bits & 0x7F;
+        ok = I2C::put(uint8_t(bits << sh));
+        if (ok && p1 != p0) ok = I2C::put(uint8_t(bits >> (8 - sh)));
+    }
+    I2C::end();
+    return ok;
+}
+
+bool GME12864_OLED::drawChar5x7(uint8_t x, uint8_t y, char c, bool on) {
+    const char s[2] = { c, 0 };
+    return drawString(x, y, s, on);
+}
+
+#endif // OLED_FRAMEBUFFER
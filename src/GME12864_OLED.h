@@ -0,0 +1,271 @@
+// GME12864_OLED.h
+//
+// Minimal I2C-based driver class for a 128x64 GME OLED-like module
+// (SSD1306 command set).
+//
+// Two render modes, picked at compile time:
+// - Streaming (default): no framebuffer. The screen is described as a scene,
+//   a list of PROGMEM canvases placed at PROGMEM regions. update() composes
+//   one strip of OLED_STRIP_WIDTH columns of one page at a time on the stack
+//   and streams it to the panel, so the driver fits in the ATtiny85's SRAM.
+// - Framebuffer (-DOLED_FRAMEBUFFER=1): a 1 KB buffer with setPixel()/
+//   drawString()/drawCanvas(), for targets with RAM to spare.
+//
+// Both use the layout from oled_blit.h: column-major, byte x * 8 + y / 8.
+
+#ifndef GME12864_OLED_H
+#define GME12864_OLED_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "oled_canvas.h"
+
+#ifndef OLED_FRAMEBUFFER
+#define OLED_FRAMEBUFFER 0
+#endif
+
+// Columns composed per I2C data transfer in streaming mode (divides WIDTH).
+#ifndef OLED_STRIP_WIDTH
+#define OLED_STRIP_WIDTH 32
+#endif
+
+// Experimental, and slower than the default on the watch: 1 overlaps
+// composing and sending in streaming mode, on backends with
+// I2C::writeAsync() (USI). Two strip buffers, one composed while the other
+// goes out under interrupts; costs another OLED_STRIP_WIDTH + 1 bytes of
+// stack in update()/step() and keeps Timer0 busy while a frame is sent.
+// The catch is the bus rate: interrupt-driven transfers run at
+// I2C_ASYNC_SCL_HZ (80 kHz, ~900 cycles a byte at 8 MHz) against 400 kHz
+// for the synchronous USI path. By hand count, not measured, a full frame
+// of ~1090 bus bytes takes ~980k cycles pipelined against ~207k plus the
+// compose time sequentially, so the pipeline only comes out ahead if
+// composing a frame takes over ~770k cycles, far above what the digit face
+// needs.
+#ifndef OLED_PIPELINE
+#define OLED_PIPELINE 0
+#endif
+
+// 1 for controllers whose horizontal scroll setup (0x26/0x27) takes a
+// column range in its last two bytes (SSD1306B and later), so startScroll()
+// moves only the region's columns. The original SSD1306 wants 0x00/0xFF
+// there and always scrolls whole pages.
+#ifndef OLED_SCROLL_COLUMNS
+#define OLED_SCROLL_COLUMNS 0
+#endif
+
+class GME12864_OLED {
+public:
+    static constexpr uint8_t WIDTH  = 128;
+    static constexpr uint8_t HEIGHT = 64;
+    static constexpr uint8_t PAGES  = HEIGHT / 8;
+    static constexpr uint16_t BUFFER_SIZE = (WIDTH * HEIGHT) / 8;
+
+    static_assert(WIDTH % OLED_STRIP_WIDTH == 0, "OLED_STRIP_WIDTH must divide WIDTH");
+
+    // SSD1306 memory addressing modes (command 0x20). Horizontal fills a
+    // window page by page, vertical column by column.
+    enum Addressing : uint8_t {
+        ADDR_HORIZONTAL = 0x00,
+        ADDR_VERTICAL   = 0x01
+    };
+
+    // Hardware scroll setup commands; the UP variants also roll the rows of
+    // the region (0xA3 scroll area) by rowsPerStep each step.
+    enum ScrollDirection : uint8_t {
+        SCROLL_RIGHT    = 0x26,
+        SCROLL_LEFT     = 0x27,
+        SCROLL_UP_RIGHT = 0x29,
+        SCROLL_UP_LEFT  = 0x2A
+    };
+
+    // Frames between scroll steps (the controller's 3-bit encoding)
+    enum ScrollInterval : uint8_t {
+        SCROLL_5_FRAMES   = 0,
+        SCROLL_64_FRAMES  = 1,
+        SCROLL_128_FRAMES = 2,
+        SCROLL_256_FRAMES = 3,
+        SCROLL_3_FRAMES   = 4,
+        SCROLL_4_FRAMES   = 5,
+        SCROLL_25_FRAMES  = 6,
+        SCROLL_2_FRAMES   = 7
+    };
+
+    // One canvas placed on the screen. Both pointers refer to PROGMEM.
+    struct SceneItem {
+        const region *at;
+        const oled_canvas *canvas;
+    };
+
+    GME12864_OLED(uint8_t address = 0x3C)
+        : address_(address) {
+        clear();
+    }
+
+    // Initialize display (basic sequence; adapt for exact controller)
+    bool init();
+
+    bool clear();
+
+#if OLED_FRAMEBUFFER
+    // Draw or clear a single pixel (x: 0..127, y: 0..63)
+    void setPixel(uint8_t x, uint8_t y, bool on) {
+        if (x >= WIDTH || y >= HEIGHT) return;
+        uint16_t byteIndex = x * PAGES + y / 8;
+        uint8_t bit = 1u << (y & 7);
+        if (on) buffer_[byteIndex] |= bit;
+        else    buffer_[byteIndex] &= ~bit;
+        markDirty(x, y, 1, 1);
+    }
+
+    // Write ASCII text using the built-in 5x7 font (6-pixel advance).
+    // Page-aligned y is the fast path: five whole column bytes per glyph.
+    void drawChar5x7(uint8_t x, uint8_t y, char c, bool on);
+    void drawString(uint8_t x, uint8_t y, const char *s);
+
+    // Copy a PROGMEM canvas into the framebuffer at a PROGMEM region
+    void drawCanvas(const region *at, const oled_canvas *canvas);
+#else
+    // Set what update() draws. Items later in the list are drawn over earlier
+    // ones and pixels not covered by any item are cleared. The array itself
+    // lives in SRAM so canvases can be swapped; it must outlive update().
+    // Only the ink (oled_canvas::ink) of the old and new items is marked
+    // dirty, so the panel must hold the old scene: call invalidate() to
+    // resend everything.
+    void setScene(SceneItem *items, uint8_t count);
+
+    // Swap the canvas of one scene item. If it actually changed, the windows
+    // of the matching transition (see setTransitions()) are marked dirty, or
+    // else the ink of the old and the new canvas.
+    void setCanvas(uint8_t index, const oled_canvas *canvas);
+
+    // Write ASCII text with the built-in 5x7 font straight to the panel,
+    // outside the scene (6-pixel advance, one transfer per call).
+    bool drawChar5x7(uint8_t x, uint8_t y, char c, bool on = true);
+    bool drawString(uint8_t x, uint8_t y, const char *s, bool on = true);
+#endif
+
+    // Dirty tracking: update() only sends the column span of each page that
+    // was marked since the last successful update.
+    void markDirty(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+    void invalidate() { markDirty(0, 0, WIDTH, HEIGHT); }
+
+    // Send the dirty parts of the framebuffer (or scene) to the display
+    bool update();
+
+    // The same in slices, so the caller can handle events in between:
+    // beginFlush() once, then step() until done(). A step sends at most
+    // `budget` data bytes (at least one column of one page), plus about 11
+    // bytes of window commands per run of pages. A byte is 9 SCL periods,
+    // 22.5 us at 400 kHz before any per-byte overhead; the bench's
+    // flush_step scenario measures a whole step. Whatever a failed step did
+    // not send stays dirty, so the next step() retries just that.
+    bool beginFlush();
+    bool step(uint16_t budget);
+    bool done() const;
+
+    // Draw a canvas into a region straight from PROGMEM, bypassing the
+    // scene/framebuffer: sets the window in vertical addressing mode and
+    // streams the bytes in the canvas' own order, with no SRAM staging.
+    // Sends the whole region, or, given the canvas the region shows now as
+    // `previous`, only the windows where the two differ (if the transition
+    // table has the pair) or else the ink of both. All pointers refer to
+    // PROGMEM.
+    bool blit(const region *at, const oled_canvas *canvas,
+              const oled_canvas *previous = nullptr);
+
+    // Precomputed canvas-to-canvas delta windows (screen_transitions[] in
+    // screen_images.h), used by setCanvas() and blit(previous). The table
+    // lives in PROGMEM.
+    void setTransitions(const oled_transition *table, uint8_t count) {
+        transitions_ = table;
+        transitionCount_ = count;
+    }
+
+    bool setContrast(uint8_t contrast) {
+        return endCommands(beginCommands() && command(0x81, contrast));
+    }
+
+    bool power(bool on) {
+        uint8_t cmd = on ? 0xAF : 0xAE;
+        return sendCommands(&cmd, 1);
+    }
+
+    // Display power profiles, each sent as one command transaction that
+    // sets the oscillator (0xD5), contrast, pre-charge (0xD9), VCOMH level
+    // (0xDB) and the scanned rows (see setUsedRows()) together. init()
+    // leaves the panel in POWER_BRIGHT. POWER_OFF switches the panel and its
+    // charge pump off; GDDRAM is kept, so any other profile brings the face
+    // back without a redraw.
+    enum PowerProfile : uint8_t {
+        POWER_BRIGHT,
+        POWER_NORMAL,
+        POWER_DIM,
+        POWER_OFF
+    };
+    bool setPowerProfile(PowerProfile profile);
+
+    // Declare that only rows [first, first + count) show anything, e.g.
+    // screen_ink from screen_images.h. The next setPowerProfile() lowers the
+    // multiplex ratio to `count`, leaving the other COM lines undriven, and
+    // moves start line and display offset so the rows stay in place (worked
+    // out for sequential COM lines; unverified on glass with the alternative
+    // COM layout init() programs). The
+    // span is clipped to the panel and widened around its middle to the
+    // controller's minimum of MIN_ROWS.
+    static constexpr uint8_t MIN_ROWS = 16; // 0xA8 takes 15..63
+    void setUsedRows(uint8_t first, uint8_t count);
+
+    // Let the panel animate the pages of a PROGMEM region on its own, e.g.
+    // slide the old digit out while the MCU sleeps. Scrolling rotates the
+    // controller's RAM, so stopping (stopScroll(), or any update()/blit()/
+    // drawString(), which must not write RAM while it scrolls) marks the
+    // scrolled area dirty; the next update() then draws the final content
+    // once. Without OLED_SCROLL_COLUMNS the whole width of the region's
+    // pages moves, and the UP directions always roll full-width rows.
+    bool startScroll(const region *at, ScrollDirection dir,
+                     ScrollInterval interval, uint8_t rowsPerStep = 1);
+    bool stopScroll();
+    bool scrolling() const { return scrolled_.width != 0; }
+
+    // Command stream: everything between beginCommands() and endCommands()
+    // goes out as one I2C transaction behind a single 0x00 control byte.
+    // endCommands() must always be called and passes `ok` through, e.g.
+    //   return endCommands(beginCommands() && command(0x81, 0x7F) && command(0xAF));
+    bool beginCommands();
+    bool command(uint8_t cmd);
+    bool command(uint8_t cmd, uint8_t arg);
+    bool endCommands(bool ok);
+    bool sendCommands(const uint8_t *cmds, uint8_t len);
+    bool sendCommands_P(const uint8_t *cmds, uint8_t len); // cmds in PROGMEM
+
+private:
+    uint8_t address_;
+    Addressing mode_ = ADDR_HORIZONTAL; // as programmed by init()
+    uint8_t dirtyLo_[PAGES] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    uint8_t dirtyHi_[PAGES] = {};
+    const oled_transition *transitions_ = nullptr;
+    uint8_t transitionCount_ = 0;
+    region scrolled_ = {}; // area the panel is scrolling; width 0 = none
+    uint8_t rowFirst_ = 0;
+    uint8_t rowCount_ = HEIGHT;
+#if OLED_FRAMEBUFFER
+    uint8_t buffer_[BUFFER_SIZE];
+#else
+    SceneItem *scene_ = nullptr;
+    uint8_t sceneCount_ = 0;
+
+    void markInk(const SceneItem &item);
+    void composeStrip(uint8_t *dst, uint8_t x0, uint8_t w, uint8_t page) const;
+#endif
+
+    bool flushWindow(uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1);
+    bool sendArea(const region &r, const oled_canvas &c, uint8_t h, region a);
+    const oled_transition *findTransition(const oled_canvas *from, const oled_canvas *to) const;
+
+    bool setWindow(uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1, Addressing mode);
+    void resync();
+};
+
+#endif // GME12864_OLED_H
@@ -0,0 +1,186 @@
+// Benchmark firmware ([env:bench]).
+//
+// Runs the display hot paths once each on the ATtiny85 under simavr, with
+// GPIOR1 holding the scenario id while it runs (traced to a VCD, see
+// simavr_mmcu.c) and one console line per scenario afterwards:
+//
+//   BENCH <id> <name> <bus bytes> <ok|fail>
+//
+// with ids 1, 2, ... in order, and "BENCH DONE <count>" once every scenario
+// ran, so a hang or crash part way shows up as missing scenarios.
+// tools/bench.py builds this, runs it and merges both into a JSON report.
+// The CPU never sleeps here, so awake time is the scenario's cycle count.
+
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <avr/sleep.h>
+#include <stdint.h>
+
+#include "GME12864_OLED.h"
+#include "clock.h"
+#include "i2c.h"
+#include "screen_images.h"
+
+// Data bytes per GME12864_OLED::step() in the flush_step scenarios, as
+// WATCH_FLUSH_STEP in main.cpp
+#ifndef BENCH_FLUSH_STEP
+#define BENCH_FLUSH_STEP 64
+#endif
+
+static const oled_canvas *digit(uint8_t d) {
+    return (const oled_canvas *)pgm_read_ptr(&number_canvases[d]);
+}
+
+// minute_ones one row down: the same 224-byte window as blit_digit, but
+// off the page grid, so blit() decodes and re-cuts every column instead of
+// bursting the canvas in its own byte order
+static const region minute_ones_shifted PROGMEM = { .x = 100, .y = 1, .width = 28, .height = 63 };
+
+static GME12864_OLED oled;
+static GME12864_OLED::SceneItem face[] = {
+    { &hour_tens,   &number_num_0 },
+    { &hour_ones,   &number_num_0 },
+    { &colon,       &colon_char_colon },
+    { &minute_tens, &number_num_0 },
+    { &minute_ones, &number_num_0 },
+};
+
+static void setTime(uint8_t h, uint8_t m) {
+    oled.setCanvas(0, digit(h / 10));
+    oled.setCanvas(1, digit(h % 10));
+    oled.setCanvas(3, digit(m / 10));
+    oled.setCanvas(4, digit(m % 10));
+}
+
+static void print(const char *s) {
+    while (*s) GPIOR0 = *s++;
+}
+
+static void print(uint16_t v) {
+    char buf[6];
+    uint8_t i = sizeof(buf);
+    buf[--i] = 0;
+    do {
+        buf[--i] = char('0' + v % 10);
+        v /= 10;
+    } while (v);
+    print(buf + i);
+}
+
+static uint8_t current;
+
+static void begin(uint8_t id) {
+    I2C::byteCount = 0;
+    current = id;
+    GPIOR1 = id;
+}
+
+// Close the scenario opened by begin(); reporting happens outside the span.
+static void end(const char *name, bool ok) {
+    GPIOR1 = 0;
+    uint16_t bytes = I2C::byteCount;
+    print("BENCH ");
+    print(uint16_t(current));
+    print(" ");
+    print(name);
+    print(" ");
+    print(bytes);
+    print(ok ? " ok\n" : " fail\n");
+}
+
+// 64 display data bytes to the panel through the streaming API, after the
+// address and the 0x40 control byte (66 on the bus): the per-byte cost of
+// I2C::put(), i.e. the backend's write_byte().
+static bool bus64() {
+    bool ok = I2C::beginWrite(0x3C) && I2C::put(0x40);
+    for (uint8_t i = 0; ok && i < 64; ++i) ok = I2C::put(0);
+    I2C::end();
+    return ok;
+}
+
+int main() {
+    bool ok;
+
+    begin(1);
+    I2C::begin();
+    ok = oled.init();
+    end("boot", ok);
+
+    oled.setTransitions(screen_transitions, SCREEN_TRANSITION_COUNT);
+    begin(2);
+    oled.setScene(face, sizeof(face) / sizeof(face[0]));
+    setTime(12, 58);
+    ok = oled.update();
+    end("full_flush", ok);
+
+    begin(3);
+    setTime(12, 59);
+    ok = oled.update();
+    end("one_digit", ok);
+
+    begin(4);
+    setTime(13, 0);
+    ok = oled.update();
+    end("minute_rollover", ok);
+
+    begin(5);
+    setTime(20, 0);
+    ok = oled.update();
+    end("hour_rollover", ok);
+
+    begin(6);
+    ok = oled.update();
+    end("no_change", ok);
+
+    begin(7);
+    ok = oled.drawString(0, 56, "12:34 MON");
+    end("draw_string", ok);
+
+    begin(8);
+    ok = oled.blit(&minute_ones, digit(7));
+    end("blit_digit", ok);
+
+    begin(9);
+    ok = bus64();
+    end("bus_64_bytes", ok);
+
+    // Worst-case latency of one flush step: the first BENCH_FLUSH_STEP
+    // bytes of a full redraw, i.e. the longest the watch's main loop goes
+    // without checking events.
+    oled.invalidate();
+    begin(10);
+    ok = oled.beginFlush() && oled.step(BENCH_FLUSH_STEP);
+    end("flush_step", ok);
+
+    // The rest of that frame in steps, against full_flush's single update()
+    begin(11);
+    while (ok && !oled.done()) ok = oled.step(BENCH_FLUSH_STEP);
+    end("flush_stepped", ok);
+
+    // The per-column path blit_digit's burst replaces (vertical addressing);
+    // the difference between the two is what the burst saves per digit
+    begin(12);
+    ok = oled.blit(&minute_ones_shifted, digit(7));
+    end("blit_digit_shifted", ok);
+
+    // A minute of watchdog ticks as the watch's main loop runs them, the
+    // last one rolling the minute over; with one_digit for the redraw this
+    // is the CPU's awake time per minute (bench.py reports the fraction).
+    // Wake-up from power-down and the loop around tick() are not included.
+    Clock::set(12, 59, 0);
+    begin(13);
+    uint8_t changed = 0;
+    for (uint8_t i = 0; i < 60; ++i) changed = Clock::tick();
+    end("minute_ticks", (changed & Clock::MINUTE_ONES) != 0);
+
+    print("BENCH DONE ");
+    print(uint16_t(current));
+    print("\n");
+
+    // simavr exits when the core sleeps with interrupts off
+    cli();
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    sleep_enable();
+    sleep_cpu();
+    for (;;);
+}
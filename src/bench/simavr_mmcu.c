@@ -0,0 +1,21 @@
+// simavr_mmcu.c
+//
+// .mmcu section read by simavr (tools/simavr_bench.c) when it loads the
+// bench firmware: core and clock, a console on GPIOR0 (one character per
+// write, printed per line) and a VCD trace of GPIOR1, which bench_main.cpp
+// sets to the running scenario id, and of SCL (its DDRB bit: the bit-bang
+// backend drives the line low by making the pin an output). tools/bench.py
+// turns the trace timestamps into cycles and the SCL releases into the
+// achieved bus clock. The section is not loaded onto the chip.
+
+#include <avr/io.h>
+#include <avr/avr_mcu_section.h>
+
+AVR_MCU(F_CPU, "attiny85");
+AVR_MCU_VCD_FILE("bench.vcd", 1000);
+AVR_MCU_SIMAVR_CONSOLE(&GPIOR0);
+
+const struct avr_mmcu_vcd_trace_t bench_trace[] _MMCU_ = {
+    { AVR_MCU_VCD_SYMBOL("scenario"), .what = (void *)&GPIOR1, },
+    { AVR_MCU_VCD_SYMBOL("scl_low"), .mask = (1 << PB2), .what = (void *)&DDRB, },
+};
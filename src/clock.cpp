@@ -0,0 +1,129 @@
+// clock.cpp
+//
+// Watchdog-timer timekeeping; see clock.h.
+
+#include <avr/eeprom.h>
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <avr/power.h>
+#include <stdint.h>
+
+#include "clock.h"
+
+uint8_t Clock::hours_;
+uint8_t Clock::minutes_;
+uint8_t Clock::seconds_;
+uint16_t Clock::fraction_;
+uint32_t Clock::tickQ16_ = Clock::ONE_SECOND;
+
+static uint32_t calibrationEE EEMEM = 0xFFFFFFFFUL;
+
+// Timer1 at CK/1024 counts this many times over the calibration window
+static constexpr uint32_t CAL_COUNTS = (F_CPU / 1024 * CLOCK_CAL_PERIODS);
+static_assert(CAL_COUNTS * 2 < 0x10000UL, "calibration count would overflow; lower CLOCK_CAL_PERIODS");
+
+// A tick outside [0.5 s, 2 s) is not a WDT "1 s" period: EEPROM is blank
+// or corrupt.
+static bool plausible(uint32_t tickQ16) {
+    return tickQ16 >= Clock::ONE_SECOND / 2 && tickQ16 < Clock::ONE_SECOND * 2;
+}
+
+void Clock::begin() {
+    uint32_t stored = eeprom_read_dword(&calibrationEE);
+    if (plausible(stored)) tickQ16_ = stored;
+    else calibrate();
+
+    // Interrupt mode, ~1 s period (WDP2 | WDP1)
+    uint8_t sreg = SREG;
+    cli();
+    MCUSR &= ~(1 << WDRF);
+    WDTCR = (1 << WDCE) | (1 << WDE);
+    WDTCR = (1 << WDIF) | (1 << WDIE) | (1 << WDP2) | (1 << WDP1);
+    SREG = sreg;
+}
+
+uint8_t Clock::tick() {
+    uint32_t acc = fraction_ + tickQ16_;
+    fraction_ = uint16_t(acc);
+    uint8_t changed = 0;
+    for (uint8_t s = uint8_t(acc >> 16); s; --s) changed |= advance();
+    return changed;
+}
+
+uint8_t Clock::set(uint8_t hours, uint8_t minutes, uint8_t seconds) {
+    uint8_t changed = 0;
+    if (seconds != seconds_)           changed |= SECOND;
+    if (minutes % 10 != minutes_ % 10) changed |= MINUTE_ONES;
+    if (minutes / 10 != minutes_ / 10) changed |= MINUTE_TENS;
+    if (hours % 10 != hours_ % 10)     changed |= HOUR_ONES;
+    if (hours / 10 != hours_ / 10)     changed |= HOUR_TENS;
+    hours_ = hours;
+    minutes_ = minutes;
+    seconds_ = seconds;
+    fraction_ = 0;
+    return changed;
+}
+
+void Clock::setCalibration(uint32_t tickQ16) {
+    if (!plausible(tickQ16)) return;
+    tickQ16_ = tickQ16;
+    eeprom_update_dword(&calibrationEE, tickQ16);
+}
+
+uint32_t Clock::calibrate() {
+    uint8_t sreg = SREG;
+    cli();
+    power_timer1_enable();
+    GTCCR = 0;
+    TCCR1 = 0;
+
+    // Start on a WDT period boundary. The WDT is (re)started here in
+    // interrupt mode so WDIF keeps being set; it is polled, not serviced.
+    MCUSR &= ~(1 << WDRF);
+    WDTCR = (1 << WDCE) | (1 << WDE);
+    WDTCR = (1 << WDIF) | (1 << WDIE) | (1 << WDP2) | (1 << WDP1);
+    while (!(WDTCR & (1 << WDIF)));
+    TCNT1 = 0;
+    TIFR = (1 << TOV1);
+    TCCR1 = (1 << CS13) | (1 << CS11) | (1 << CS10); // CK/1024
+    WDTCR |= (1 << WDIF);
+
+    uint8_t overflows = 0;
+    for (uint8_t n = 0; n < CLOCK_CAL_PERIODS; ) {
+        if (TIFR & (1 << TOV1)) {
+            TIFR = (1 << TOV1);
+            ++overflows;
+        }
+        if (WDTCR & (1 << WDIF)) {
+            WDTCR |= (1 << WDIF);
+            ++n;
+        }
+    }
+    uint8_t low = TCNT1;
+    if ((TIFR & (1 << TOV1)) && low < 0x80) ++overflows; // wrapped before the read
+    TCCR1 = 0;
+    TIFR = (1 << TOV1);
+    power_timer1_disable();
+    SREG = sreg;
+
+    uint32_t counts = (uint32_t(overflows) << 8) | low;
+    setCalibration(((counts << 16) + CAL_COUNTS / 2) / CAL_COUNTS);
+    return tickQ16_;
+}
+
+// Private
+
+uint8_t Clock::advance() {
+    uint8_t changed = SECOND;
+    if (++seconds_ < 60) return changed;
+    seconds_ = 0;
+    changed |= MINUTE_ONES;
+    if (++minutes_ % 10) return changed;
+    changed |= MINUTE_TENS;
+    if (minutes_ < 60) return changed;
+    minutes_ = 0;
+    changed |= HOUR_ONES;
+    if (++hours_ == 24) hours_ = 0;
+    if (hours_ % 10 == 0) changed |= HOUR_TENS;
+    return changed;
+}
@@ -0,0 +1,76 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdint.h>
+
+// Watchdog-timer timekeeping for ATtiny85.
+//
+// The WDT runs in interrupt mode with a nominal 1 s period and keeps running
+// in power-down. Its oscillator is only good to ~10%, so every tick adds a
+// calibrated tick length (seconds, unsigned Q16.16) to a fractional
+// accumulator and the clock advances by however many whole seconds that
+// makes: calibration costs no extra wakeups. The tick length is kept in
+// EEPROM.
+//
+// A 32.768 kHz crystal is not an option here: the ATtiny85 has no
+// asynchronous timer, so a watch crystal could only replace the system
+// clock (on PB3/PB4: PB3 is a button, PB4 is left unused) and I2C would
+// crawl.
+
+#ifndef CLOCK_CAL_PERIODS
+#define CLOCK_CAL_PERIODS 4 // WDT periods timed by calibrate()
+#endif
+
+class Clock {
+public:
+    // Bits of the "what changed" mask returned by tick() and set(), one per
+    // displayed field, so the caller only redraws the affected regions.
+    enum : uint8_t {
+        SECOND      = 0x01,
+        MINUTE_ONES = 0x02,
+        MINUTE_TENS = 0x04,
+        HOUR_ONES   = 0x08,
+        HOUR_TENS   = 0x10,
+        MINUTE      = MINUTE_ONES | MINUTE_TENS,
+        HOUR        = HOUR_ONES | HOUR_TENS
+    };
+
+    static constexpr uint32_t ONE_SECOND = 0x10000UL; // Q16.16
+
+    // Load the stored calibration (measuring one with calibrate() if
+    // EEPROM holds none) and start the WDT interrupt. The caller provides
+    // ISR(WDT_vect) and calls tick() for each interrupt.
+    static void begin();
+
+    // Account for one WDT period; returns the changed-fields mask (0 when
+    // the tick did not complete a second).
+    static uint8_t tick();
+
+    // Set the time of day; returns the changed-fields mask
+    static uint8_t set(uint8_t hours, uint8_t minutes, uint8_t seconds = 0);
+
+    static uint8_t hours()   { return hours_; }
+    static uint8_t minutes() { return minutes_; }
+    static uint8_t seconds() { return seconds_; }
+
+    // Tick length in Q16.16 seconds. setCalibration() stores it in EEPROM,
+    // e.g. after comparing the watch against a reference over a few days.
+    static uint32_t calibration() { return tickQ16_; }
+    static void setCalibration(uint32_t tickQ16);
+
+    // Time CLOCK_CAL_PERIODS WDT periods against the CPU clock with Timer1
+    // and store the result. Blocks for the measurement (~4 s) with
+    // interrupts off. Only as accurate as F_CPU: tune OSCCAL (or run from a
+    // crystal) first, the factory-calibrated RC oscillator is itself a few
+    // percent off.
+    static uint32_t calibrate();
+
+private:
+    static uint8_t hours_, minutes_, seconds_;
+    static uint16_t fraction_;  // sub-second part of the accumulator
+    static uint32_t tickQ16_;
+
+    static uint8_t advance();   // one second forward, returns changed mask
+};
+
+#endif // CLOCK_H
@@ -1,7 +1,7 @@
 // File: /home/ded/Projects/tinkermill/tinkermill_classes/eletronics/avr-watch/AVR-watch/src/i2c.cpp
 //
 // Simple bit-banged I2C master for ATtiny85 (SDA = PB0, SCL = PB2).
-// Lightweight, blocking, ~100kHz (depends on _delay_us timing and F_CPU).
+// Lightweight, blocking; SCL runs at I2C_SCL_HZ as far as the loop allows.
 //
 // Usage:
 //   I2C::begin();
@@ -11,74 +11,263 @@
 // Notes:
 // - Requires external pull-ups on SDA and SCL lines.
 // - Keeps API small and synchronous.
+// - This file holds the public API (shared by all backends) and the
+//   bit-banged backend. The USI backend lives in i2c_usi.cpp, the unrolled
+//   bit-bang writer in i2c_unrolled.cpp (which uses the rest of the
+//   bit-banged backend from here); pick one with I2C_BACKEND (see i2c.h).
 
-#include <avr/io.h>
-#include <util/delay.h>
 #include <stdint.h>
 
 #include "i2c.h"
 
+#define I2C_BITBANG_PINS (I2C_BACKEND == I2C_BACKEND_BITBANG || I2C_BACKEND == I2C_BACKEND_UNROLLED)
+
+#if I2C_BITBANG_PINS
+#include <avr/io.h>
+
+#include "i2c_timing.h"
+#endif
+
+#if I2C_STATS
+uint16_t I2C::byteCount;
+#define I2C_COUNT(n) (byteCount += (n))
+#else
+#define I2C_COUNT(n) ((void)0)
+#endif
+
+I2C::Error I2C::error_;
+
+// Public
+
+bool I2C::write(uint8_t addr7, const uint8_t *data, uint8_t len) {
+    bool ok = beginWrite(addr7);
+    if (ok) {
+        I2C_COUNT(len);
+        ok = sent(write_bytes(data, len), ERROR_NACK_DATA);
+    }
+    end();
+    return ok;
+}
+
+bool I2C::read(uint8_t addr7, uint8_t *buf, uint8_t len) {
+    error_ = ERROR_NONE;
+    bool ok = start_condition() && receive(addr7, buf, len);
+    stop_condition();
+    return ok;
+}
+
+// start_condition() doubles as the repeated START: every backend releases
+// SDA, keeps SCL low for a full low time (the slave's ACK hold time runs
+// out in it), then releases SCL before pulling SDA low.
+bool I2C::writeRead(uint8_t addr7, const uint8_t *tx, uint8_t txLen,
+                    uint8_t *rx, uint8_t rxLen) {
+    bool ok = beginWrite(addr7);
+    if (ok) {
+        I2C_COUNT(txLen);
+        ok = sent(write_bytes(tx, txLen), ERROR_NACK_DATA);
+    }
+    if (ok && rxLen) {
+        ok = start_condition() && receive(addr7, rx, rxLen);
+    }
+    end();
+    return ok;
+}
+
+bool I2C::beginWrite(uint8_t addr7) {
+    error_ = ERROR_NONE;
+    if (!start_condition()) return false;
+    I2C_COUNT(1);
+    return sent(write_byte(uint8_t(addr7 << 1)), ERROR_NACK_ADDRESS);
+}
+
+bool I2C::put(uint8_t b) {
+    I2C_COUNT(1);
+    return sent(write_byte(b), ERROR_NACK_DATA);
+}
+
+void I2C::end() {
+    stop_condition();
+}
+
+bool I2C::writeRegister(uint8_t addr7, uint8_t reg, uint8_t val) {
+    uint8_t data[2] = { reg, val };
+    return write(addr7, data, 2);
+}
+
+bool I2C::readRegister(uint8_t addr7, uint8_t reg, uint8_t &val) {
+    return writeRead(addr7, &reg, 1, &val, 1);
+}
+
+bool I2C::readRegisters(uint8_t addr7, uint8_t reg, uint8_t *buf, uint8_t len) {
+    return writeRead(addr7, &reg, 1, buf, len);
+}
+
 // Private
 
-void I2C::start_condition() {
+bool I2C::receive(uint8_t addr7, uint8_t *buf, uint8_t len) {
+    I2C_COUNT(1);
+    if (!sent(write_byte(uint8_t((addr7 << 1) | 1)), ERROR_NACK_ADDRESS)) return false;
+    I2C_COUNT(len);
+    for (uint8_t i = 0; error_ == ERROR_NONE && i < len; ++i) {
+        buf[i] = read_byte(i + 1 < len); // NACK the last byte
+    }
+    return error_ == ERROR_NONE;
+}
+
+// A failed byte is a NACK unless the backend already reported why
+bool I2C::sent(bool ack, Error nack) {
+    if (!ack && error_ == ERROR_NONE) error_ = nack;
+    return ack;
+}
+
+#if I2C_BACKEND != I2C_BACKEND_UNROLLED
+// Backends without a bulk path send byte by byte
+bool I2C::write_bytes(const uint8_t *data, uint8_t len) {
+    for (uint8_t i = 0; i < len; ++i) {
+        if (!write_byte(data[i])) return false;
+    }
+    return true;
+}
+#endif
+
+#if I2C_BITBANG_PINS
+
+// Open-drain emulation: PORTB bits stay 0, DDRB selects drive-low vs release.
+inline void I2C::sda_low()       { DDRB |= (1 << SDA_b); }
+inline void I2C::sda_release()   { DDRB &= ~(1 << SDA_b); }
+inline uint8_t I2C::sda_read()   { return PINB & (1 << SDA_b); }
+
+inline void I2C::scl_low()       { DDRB |= (1 << SCL_b); }
+inline void I2C::scl_release()   { DDRB &= ~(1 << SCL_b); }
+
+void I2C::begin() {
+    PORTB &= ~((1 << SDA_b) | (1 << SCL_b));
     sda_release();
     scl_release();
-    i2c_delay();
+}
+
+// Private
+
+// Bit timing: two delays per bit, one per SCL half. The loop's own work is
+// part of each half, so it is taken off the delays. The overheads are what
+// -Os is expected to make of write_byte(), not read off a listing: in the
+// low half the loop branch, the data bit test and its sbi/cbi, the shift
+// and the SCL release (11 cycles); in the high half the SCL check at its
+// end (sbis skipping the jump to scl_wait(), 2) and the sbi pulling SCL
+// low (2). At 8 MHz and 400 kHz that leaves 4 + 1 delay cycles: a 20-cycle
+// bit, 15 low (1.9 us) and 5 high (625 ns), if the counts hold. bench.py
+// reports the achieved SCL rate per scenario (scl_hz); if it falls short,
+// correct LOW_OVERHEAD/HIGH_OVERHEAD from avr-objdump -d. At lower F_CPU
+// the loop alone outlasts the period and the bus runs slower.
+namespace {
+
+using namespace i2c_timing;
+
+constexpr uint32_t LOW_OVERHEAD  = 11;
+constexpr uint32_t HIGH_OVERHEAD = 4;
+
+inline void delay_low()  { __builtin_avr_delay_cycles(sub_sat(LOW_CYCLES, LOW_OVERHEAD)); }
+inline void delay_high() { __builtin_avr_delay_cycles(sub_sat(HIGH_CYCLES, HIGH_OVERHEAD)); }
+
+} // namespace
+
+// The high half of a clock: release SCL, wait the high time, then check
+// that the line actually rose. Checking at the end leaves the pull-up the
+// whole high half (plus the input synchronizer's cycle) to reach VIH, so
+// only a slave stretching the clock, or an edge slower than that half,
+// takes the out-of-line wait.
+inline bool I2C::scl_rise() {
+    scl_release();
+    delay_high();
+    return (PINB & (1 << SCL_b)) || scl_wait();
+}
+
+// Poll SCL for up to I2C_STRETCH_TIMEOUT_US
+bool I2C::scl_wait() {
+    for (uint16_t n = STRETCH_POLLS; n; --n) {
+        if (PINB & (1 << SCL_b)) return true;
+    }
+    error_ = ERROR_TIMEOUT;
+    return false;
+}
+
+// Also the repeated START: write_byte() returns right after pulling SCL
+// low, so SCL stays low for tLOW with SDA released (the slave lets go of
+// its ACK within tHD;DAT) before it is raised and SDA falls. Otherwise a
+// still-held ACK would read as a stuck bus.
+bool I2C::start_condition() {
+    sda_release();
+    delay_low();
+    if (!scl_rise()) return false;
+    if (!sda_read() && !recover()) return false;
+    delay_low();      // tBUF / tSU;STA
     sda_low();
-    i2c_delay();
+    delay_high();     // tHD;STA
     scl_low();
-    i2c_delay();
+    return true;
 }
 
 void I2C::stop_condition() {
     sda_low();
-    i2c_delay();
-    scl_release();
-    i2c_delay();
+    delay_low();
+    scl_rise();       // tSU;STO; on a timeout error_ already says so
     sda_release();
-    i2c_delay();
+    delay_low();      // tBUF before the next START
 }
 
+bool I2C::recover() {
+    sda_release();
+    for (uint8_t i = 0; i < 9 && !sda_read(); ++i) {
+        scl_low();
+        delay_low();
+        if (!scl_rise()) return false;
+    }
+    if (!sda_read()) {
+        error_ = ERROR_BUS_STUCK;
+        return false;
+    }
+    scl_low();
+    stop_condition();
+    return true;
+}
+
+#if I2C_BACKEND == I2C_BACKEND_BITBANG
+// SDA changes right after SCL falls, so it is set up for the whole low half.
 bool I2C::write_byte(uint8_t b) {
     for (uint8_t i = 0; i < 8; ++i) {
         if (b & 0x80) sda_release(); else sda_low();
         b <<= 1;
-        i2c_delay();
-        scl_release();
-        i2c_delay();
+        delay_low();
+        if (!scl_rise()) return false;
         scl_low();
-        i2c_delay();
     }
     // ACK bit
     sda_release(); // release SDA for ACK
-    i2c_delay();
-    scl_release();
-    i2c_delay();
+    delay_low();
+    if (!scl_rise()) return false;
     bool ack = (sda_read() == 0);
     scl_low();
-    i2c_delay();
     return ack;
 }
+#endif
 
 uint8_t I2C::read_byte(bool ack) {
     uint8_t b = 0;
+    sda_release();
     for (uint8_t i = 0; i < 8; ++i) {
         b <<= 1;
-        sda_release();
-        i2c_delay();
-        scl_release();
-        i2c_delay();
+        delay_low();
+        if (!scl_rise()) return 0xFF;
         if (sda_read()) b |= 1;
         scl_low();
-        i2c_delay();
     }
     // send ACK/NACK
-    if (ack) sda_low(); else sda_release();
-    i2c_delay();
-    scl_release();
-    i2c_delay();
+    if (ack) sda_low();
+    delay_low();
+    scl_rise();
     scl_low();
-    i2c_delay();
     sda_release();
     return b;
-}
\ No newline at end of file
+}
+
+#endif // I2C_BITBANG_PINS
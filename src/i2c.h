@@ -3,17 +3,123 @@
 
 #include <stdint.h>
 
+// Backend selection. Override with e.g. -DI2C_BACKEND=I2C_BACKEND_USI in
+// platformio.ini build_flags; the public API is identical for every backend.
+#define I2C_BACKEND_BITBANG 0 // SDA/SCL toggled by hand (i2c.cpp)
+#define I2C_BACKEND_USI     1 // ATtiny85 USI two-wire mode (i2c_usi.cpp)
+#define I2C_BACKEND_SIM     2 // host builds: simulated bus (i2c_sim.cpp)
+#define I2C_BACKEND_UNROLLED 3 // bit-bang, unrolled byte writer (i2c_unrolled.cpp)
+
+#ifndef I2C_BACKEND
+#define I2C_BACKEND I2C_BACKEND_BITBANG
+#endif
+
+// Target SCL frequency for the bit-bang, unrolled and USI backends: 100000
+// (Standard-mode), 400000 (Fast-mode) or 1000000 (Fast-mode Plus). The bit
+// timing is derived from it and F_CPU at compile time (i2c_timing.h).
+#ifndef I2C_SCL_HZ
+#define I2C_SCL_HZ 400000UL
+#endif
+
+// SCL frequency for interrupt-driven transfers (USI backend). Every SCL edge
+// costs a ~12-cycle Timer0 interrupt, and the USI overflow ISR must get in
+// within half a period (checked in i2c_usi.cpp): at most ~85 kHz at 8 MHz.
+#ifndef I2C_ASYNC_SCL_HZ
+#define I2C_ASYNC_SCL_HZ 80000UL
+#endif
+
+// Depth of the asynchronous transmit ring (power of two).
+#ifndef I2C_QUEUE_LEN
+#define I2C_QUEUE_LEN 4
+#endif
+
+// Longest a slave may hold SCL low (clock stretching) before the transfer
+// is abandoned with ERROR_TIMEOUT, in microseconds. Keeps a stuck slave
+// from holding the watch awake.
+#ifndef I2C_STRETCH_TIMEOUT_US
+#define I2C_STRETCH_TIMEOUT_US 1000UL
+#endif
+
+// Count bytes put on the bus (address bytes included) in I2C::byteCount.
+// Used by the benchmark firmware ([env:bench]); off by default.
+#ifndef I2C_STATS
+#define I2C_STATS 0
+#endif
+
 class I2C {
 public:
+    // Why the last transaction failed (every call below returning false
+    // sets one; the next START clears it)
+    enum Error : uint8_t {
+        ERROR_NONE = 0,
+        ERROR_NACK_ADDRESS, // no slave answered the address byte
+        ERROR_NACK_DATA,    // the slave refused a data byte
+        ERROR_TIMEOUT,      // SCL held low past I2C_STRETCH_TIMEOUT_US
+        ERROR_BUS_STUCK     // SDA still low after the bus clear
+    };
+
     // Public API
     static void begin();
     static bool write(uint8_t addr7, const uint8_t *data, uint8_t len);
     static bool read(uint8_t addr7, uint8_t *buf, uint8_t len);
     static bool writeRegister(uint8_t addr7, uint8_t reg, uint8_t val);
+
+    // Combined transaction: START, write `tx`, repeated START, read `rx`
+    // (NACKing the last byte), STOP. No STOP between the two halves, so no
+    // other master or reset can get in between the register pointer write
+    // and the read, and it costs one STOP/START less. Either length may be 0.
+    static bool writeRead(uint8_t addr7, const uint8_t *tx, uint8_t txLen,
+                          uint8_t *rx, uint8_t rxLen);
+
+    // Register reads through writeRead(): one register, or a burst of `len`
+    // from `reg` on for devices that auto-increment their register pointer.
     static bool readRegister(uint8_t addr7, uint8_t reg, uint8_t &val);
+    static bool readRegisters(uint8_t addr7, uint8_t reg, uint8_t *buf, uint8_t len);
+
+    // Streaming write: START + address, any number of put()s, then end()
+    // (STOP). Lets callers feed bytes one at a time, e.g. straight from
+    // PROGMEM, without staging them in a buffer. end() must always be called.
+    static bool beginWrite(uint8_t addr7);
+    static bool put(uint8_t b);
+    static void end();
+
+    static Error lastError() { return error_; }
+
+    // Bus clear (I2C spec 3.1.16): a slave that lost track mid-byte holds
+    // SDA low; up to nine SCL pulses clock it out, then a STOP frees the
+    // bus. A START that finds SDA low runs this by itself.
+    static bool recover();
+
+#if I2C_BACKEND == I2C_BACKEND_USI || I2C_BACKEND == I2C_BACKEND_SIM
+#define I2C_ASYNC 1
+    // Asynchronous transmit, driven by the USI overflow and Timer0 compare
+    // interrupts. writeAsync() queues the transfer and returns immediately
+    // (false if the ring is full); `data` must stay valid until `done` is
+    // called, from interrupt context, with the ACK result. Takes over Timer0
+    // while transfers are in flight and holds off the pin change and
+    // watchdog interrupts (they fire when the transfer ends); any other
+    // interrupt must stay disabled meanwhile, as it would delay the USI
+    // overflow past the next SCL edge. Synchronous calls wait for the queue.
+    // The SIM backend sends the transfer and calls `done` before returning.
+    typedef void (*Callback)(bool ok);
+    static bool writeAsync(uint8_t addr7, const uint8_t *data, uint8_t len,
+                           Callback done = nullptr);
+    static bool busy();
+    // Idle-sleep until at most `pending` transfers are queued (the one in
+    // flight included), e.g. 1 to reuse the buffer of the one before it
+    static void flush(uint8_t pending = 0);
+#else
+#define I2C_ASYNC 0
+#endif
+
+#if I2C_STATS
+    static uint16_t byteCount;
+#endif
 
 private:
-    // Pin definitions for ATtiny85
+    static Error error_;
+
+    // Pin definitions for ATtiny85 (these are also the USI SDA/SCL pins)
     static constexpr uint8_t SDA_b = 0; // PB0
     static constexpr uint8_t SCL_b = 2; // PB2
 
@@ -24,13 +130,29 @@ private:
 
     static inline void scl_low();
     static inline void scl_release();
+    static inline bool scl_rise(); // release for the high half, then check it rose
+    static bool scl_wait();
 
-    static inline void i2c_delay();
-
-    static void start_condition();
+    // Bus primitives, implemented once per backend. start_condition() fails
+    // (with error_ set) if the bus cannot be taken; the others set error_
+    // on a stretch timeout.
+    static bool start_condition();
     static void stop_condition();
     static bool write_byte(uint8_t b);
+    static bool write_bytes(const uint8_t *data, uint8_t len); // stops at a NACK
     static uint8_t read_byte(bool ack);
+
+    // Read address byte and `len` bytes, after a START or repeated START
+    static bool receive(uint8_t addr7, uint8_t *buf, uint8_t len);
+    static bool sent(bool ack, Error nack);
+
+#if I2C_BACKEND == I2C_BACKEND_USI
+    static uint8_t usi_transfer(uint8_t status);
+#endif
+#if I2C_BACKEND == I2C_BACKEND_UNROLLED
+    template<uint8_t N> static bool send_bit(uint8_t b);
+    static bool send_byte(uint8_t b);
+#endif
 };
 
-#endif // I2C_H
\ No newline at end of file
+#endif // I2C_H
@@ -0,0 +1,76 @@
+// i2c_sim.cpp
+//
+// I2C backend for host builds ([env:native]): every bus primitive is
+// forwarded to the simulated bus in lib/sim, which counts and records the
+// traffic and feeds it to the attached device models (e.g. SSD1306Model).
+// Faults injected on the bus (held SCL or SDA) go through the same error
+// handling as on the chip.
+
+#include <stdint.h>
+
+#include "i2c.h"
+
+#if I2C_BACKEND == I2C_BACKEND_SIM
+
+#include "sim_bus.h"
+
+void I2C::begin() {
+}
+
+// No queue: the transfer is over before writeAsync() returns
+bool I2C::writeAsync(uint8_t addr7, const uint8_t *data, uint8_t len, Callback done) {
+    bool ok = write(addr7, data, len);
+    if (done) done(ok);
+    return true;
+}
+
+bool I2C::busy() {
+    return false;
+}
+
+void I2C::flush(uint8_t pending) {
+    (void)pending;
+}
+
+// Private
+
+// A held SCL never rises, so it times out at once
+bool I2C::scl_wait() {
+    if (!SimBus::sclHeld()) return true;
+    error_ = ERROR_TIMEOUT;
+    return false;
+}
+
+bool I2C::start_condition() {
+    if (!scl_wait()) return false;
+    if (SimBus::sdaHeld() && !recover()) return false;
+    SimBus::start();
+    return true;
+}
+
+void I2C::stop_condition() {
+    if (scl_wait()) SimBus::stop();
+}
+
+bool I2C::recover() {
+    for (uint8_t i = 0; i < 9 && SimBus::sdaHeld(); ++i) {
+        if (!scl_wait()) return false;
+        SimBus::clock();
+    }
+    if (SimBus::sdaHeld()) {
+        error_ = ERROR_BUS_STUCK;
+        return false;
+    }
+    stop_condition();
+    return true;
+}
+
+bool I2C::write_byte(uint8_t b) {
+    return scl_wait() && SimBus::write(b);
+}
+
+uint8_t I2C::read_byte(bool ack) {
+    return scl_wait() ? SimBus::read(ack) : 0xFF;
+}
+
+#endif // I2C_BACKEND == I2C_BACKEND_SIM
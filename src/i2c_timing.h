@@ -0,0 +1,40 @@
+// i2c_timing.h
+//
+// SCL timing shared by the AVR backends, derived at compile time from F_CPU
+// and I2C_SCL_HZ: the I2C spec minimum low/high times of the selected bus
+// mode (Standard-mode, Fast-mode or Fast-mode Plus), rounded up to cycles,
+// with the low time stretched to make up the requested period. Each backend
+// subtracts the cycles its own code spends in either half. Also the poll
+// count for the clock-stretch timeout.
+
+#ifndef I2C_TIMING_H
+#define I2C_TIMING_H
+
+#include <stdint.h>
+
+#include "i2c.h"
+
+namespace i2c_timing {
+
+constexpr uint32_t T_LOW_NS  = I2C_SCL_HZ > 400000UL ? 500 : (I2C_SCL_HZ > 100000UL ? 1300 : 4700);
+constexpr uint32_t T_HIGH_NS = I2C_SCL_HZ > 400000UL ? 260 : (I2C_SCL_HZ > 100000UL ? 600 : 4000);
+
+constexpr uint32_t ns_to_cycles(uint32_t ns) {
+    return (ns * (F_CPU / 1000000UL) + 999) / 1000;
+}
+
+constexpr uint32_t max_u32(uint32_t a, uint32_t b) { return a > b ? a : b; }
+constexpr uint32_t sub_sat(uint32_t a, uint32_t b) { return a > b ? a - b : 0; }
+
+constexpr uint32_t PERIOD_CYCLES = F_CPU / I2C_SCL_HZ;
+constexpr uint32_t HIGH_CYCLES   = ns_to_cycles(T_HIGH_NS);
+constexpr uint32_t LOW_CYCLES    = max_u32(ns_to_cycles(T_LOW_NS), sub_sat(PERIOD_CYCLES, HIGH_CYCLES));
+
+// Iterations of a SCL poll loop (about 6 cycles each: in, test, counter,
+// branch) that make up I2C_STRETCH_TIMEOUT_US
+constexpr uint32_t STRETCH_POLLS_RAW = I2C_STRETCH_TIMEOUT_US * (F_CPU / 1000000UL) / 6;
+constexpr uint16_t STRETCH_POLLS = STRETCH_POLLS_RAW > 0xFFFF ? 0xFFFF : (STRETCH_POLLS_RAW ? STRETCH_POLLS_RAW : 1);
+
+} // namespace i2c_timing
+
+#endif // I2C_TIMING_H
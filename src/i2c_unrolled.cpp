@@ -0,0 +1,117 @@
+// i2c_unrolled.cpp
+//
+// Bit-banged I2C backend with a hand-scheduled byte writer, for boards where
+// the USI pins are taken by something else (SDA = PB0, SCL = PB2 as in
+// i2c.cpp, whose START/STOP and read path it shares). Selected with
+// -DI2C_BACKEND=I2C_BACKEND_UNROLLED.
+//
+// The 8 data bits are unrolled, each one a fixed instruction sequence on
+// DDRB (open drain: output = drive low, input = release):
+//
+//   sbrs b, n ; sbi DDRB, SDA      5 cycles whatever the bit: one of the
+//   sbrc b, n ; cbi DDRB, SDA      two skips, the other executes
+//   <delay>                        rest of the SCL low half
+//   cbi DDRB, SCL                  2, SCL released
+//   <delay>                        rest of the SCL high half
+//   sbis PINB, SCL ; rjmp wait     2, clock-stretch check (I2C::scl_wait())
+//   sbi DDRB, SCL                  2, SCL low
+//
+// so a bit is 11 cycles, 7 in the low half (data bit and SCL release) and
+// 4 in the high half (stretch check and SCL low), as LOW_OVERHEAD and
+// HIGH_OVERHEAD below, plus the delays from i2c_timing.h: at 8 MHz and
+// 400 kHz a 20-cycle bit, with no loop counter, shift or data-dependent
+// branch. write_bytes() inlines the whole byte into its loop, so
+// I2C::write() pays no call per byte either. These counts are the
+// datasheet timings of the sequence above; the ACK and the per-byte code
+// around it are not counted. tools/bench.py --env bench_unrolled measures
+// the whole byte (bus_64_bytes, cycles_per_byte) against [env:bench].
+
+#include <avr/io.h>
+#include <stdint.h>
+
+#include "i2c.h"
+
+#if I2C_BACKEND == I2C_BACKEND_UNROLLED
+
+#include "i2c_timing.h"
+
+namespace {
+
+using namespace i2c_timing;
+
+constexpr uint8_t SDA_PIN = PB0;
+constexpr uint8_t SCL_PIN = PB2;
+
+// Cycles of the sequence above in each SCL half: the data bit and the SCL
+// release in the low half, the SCL check and the sbi pulling SCL low in the
+// high half.
+constexpr uint32_t LOW_OVERHEAD  = 7;
+constexpr uint32_t HIGH_OVERHEAD = 4;
+
+__attribute__((always_inline)) inline void delay_low()  { __builtin_avr_delay_cycles(sub_sat(LOW_CYCLES, LOW_OVERHEAD)); }
+__attribute__((always_inline)) inline void delay_high() { __builtin_avr_delay_cycles(sub_sat(HIGH_CYCLES, HIGH_OVERHEAD)); }
+
+__attribute__((always_inline)) inline void scl_up() {
+    asm volatile("cbi %0, %1" :: "I"(_SFR_IO_ADDR(DDRB)), "I"(SCL_PIN));
+}
+
+__attribute__((always_inline)) inline bool scl_is_high() {
+    return PINB & (1 << SCL_PIN);
+}
+
+__attribute__((always_inline)) inline void scl_down() {
+    asm volatile("sbi %0, %1" :: "I"(_SFR_IO_ADDR(DDRB)), "I"(SCL_PIN));
+}
+
+} // namespace
+
+// Raw sbi/cbi rather than the I2C::scl_* helpers of i2c.cpp, so the
+// sequence stays as counted above. SCL is checked at the end of the high
+// half, once the pull-up had time to raise it, so the sequence falls
+// through to I2C::scl_wait() (i2c.cpp) only while a slave stretches the
+// clock.
+template<uint8_t N>
+__attribute__((always_inline)) inline bool I2C::send_bit(uint8_t b) {
+    asm volatile(
+        "sbrs %0, %1\n\t"
+        "sbi %2, %3\n\t"
+        "sbrc %0, %1\n\t"
+        "cbi %2, %3\n\t"
+        :: "r"(b), "I"(N), "I"(_SFR_IO_ADDR(DDRB)), "I"(SDA_PIN));
+    delay_low();
+    scl_up();
+    delay_high();
+    if (!scl_is_high() && !scl_wait()) return false;
+    scl_down();
+    return true;
+}
+
+// Eight data bits, then SDA released for the slave's ACK, sampled while SCL
+// is high. Returns true on ACK.
+__attribute__((always_inline)) inline bool I2C::send_byte(uint8_t b) {
+    if (!(send_bit<7>(b) && send_bit<6>(b) && send_bit<5>(b) && send_bit<4>(b)
+          && send_bit<3>(b) && send_bit<2>(b) && send_bit<1>(b) && send_bit<0>(b))) {
+        return false;
+    }
+    asm volatile("cbi %0, %1" :: "I"(_SFR_IO_ADDR(DDRB)), "I"(SDA_PIN));
+    delay_low();
+    scl_up();
+    delay_high();
+    if (!scl_is_high() && !scl_wait()) return false;
+    uint8_t pins = PINB;
+    scl_down();
+    return !(pins & (1 << SDA_PIN));
+}
+
+bool I2C::write_byte(uint8_t b) {
+    return send_byte(b);
+}
+
+bool I2C::write_bytes(const uint8_t *data, uint8_t len) {
+    for (; len; --len) {
+        if (!send_byte(*data++)) return false;
+    }
+    return true;
+}
+
+#endif // I2C_BACKEND == I2C_BACKEND_UNROLLED
@@ -0,0 +1,370 @@
+// i2c_usi.cpp
+//
+// I2C master backend for ATtiny85 built on the USI in two-wire mode
+// (SDA = PB0, SCL = PB2). Selected with -DI2C_BACKEND=I2C_BACKEND_USI.
+//
+// The USI shifts USIDR out on SDA and counts SCL edges in hardware; we only
+// have to strobe USITC once per edge, so a bit costs a handful of cycles plus
+// the spec-mandated low/high times. Bit timing is derived at compile time from
+// F_CPU and I2C_SCL_HZ (Standard-mode, Fast-mode or Fast-mode Plus minimums).
+//
+// Cycle comparison at F_CPU = 8 MHz, one data byte incl. ACK, no START/STOP.
+// Hand counts, not measurements: 9 bits x the period from i2c_timing.h plus
+// the per-byte call and setup work read off the source.
+//
+//   backend                        cycles/byte   1 KB flush (8 x 129 B + headers)
+//   bit-bang, I2C_SCL_HZ = 400 kHz     ~200          ~215k cycles  (~27 ms)
+//   USI, I2C_SCL_HZ = 400 kHz          ~190          ~205k cycles  (~26 ms)
+//   USI, I2C_SCL_HZ = 1 MHz             ~80           ~88k cycles  (~11 ms)
+//
+// tools/bench.py measures the bit-bang row (bus_64_bytes and full_flush in
+// bench/bench.json); simavr has no USI model, so the USI rows can only be
+// checked on hardware, e.g. by timing update() with a spare pin on a scope.
+// The bit-bang backend cannot go faster than its loop overhead allows (see
+// i2c.cpp). The SSD1306 is only specified to 400 kHz, but
+// most modules run fine at 1 MHz with strong (<= 2k2) pull-ups.
+
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <avr/sleep.h>
+#include <stdint.h>
+
+#include "i2c.h"
+#include "i2c_timing.h"
+
+#if I2C_BACKEND == I2C_BACKEND_USI
+
+namespace {
+
+using namespace i2c_timing;
+
+// Cycles already spent in each half of the usi_transfer() loop: the USIOIF
+// test, the loop branch and the USICR store releasing SCL in the low half;
+// the SCL check at the end of the high half (sbis skipping the call to
+// scl_wait(), 2) and the USICR store pulling SCL low in the high half.
+constexpr uint32_t LOW_OVERHEAD  = 4;
+constexpr uint32_t HIGH_OVERHEAD = 3;
+
+inline void delay_low()  { __builtin_avr_delay_cycles(sub_sat(LOW_CYCLES, LOW_OVERHEAD)); }
+inline void delay_high() { __builtin_avr_delay_cycles(sub_sat(HIGH_CYCLES, HIGH_OVERHEAD)); }
+
+// Two-wire mode, 4-bit counter clocked by USITC strobes, data shifted on the
+// external (SCL) edge.
+constexpr uint8_t USICR_TWI = (1 << USIWM1) | (1 << USICS1) | (1 << USICLK);
+
+// Clear all flags and preload the counter: 16 edges for a byte, 2 for ACK.
+constexpr uint8_t USISR_FLAGS = (1 << USISIF) | (1 << USIOIF) | (1 << USIPF) | (1 << USIDC);
+constexpr uint8_t USISR_8BIT  = USISR_FLAGS | (0x0 << USICNT0);
+constexpr uint8_t USISR_1BIT  = USISR_FLAGS | (0xE << USICNT0);
+
+constexpr uint8_t SDA_PIN = PB0;
+constexpr uint8_t SCL_PIN = PB2;
+
+// Poll a released SCL for up to I2C_STRETCH_TIMEOUT_US
+bool scl_settle() {
+    for (uint16_t n = STRETCH_POLLS; n; --n) {
+        if (PINB & (1 << SCL_PIN)) return true;
+    }
+    return false;
+}
+
+// Both fail only if a slave holds SCL low past the timeout
+inline bool bus_start() {
+    PORTB |= (1 << SCL_PIN);
+    if (!scl_settle()) return false;
+    delay_low();                              // tSU;STA / tBUF
+    PORTB &= ~(1 << SDA_PIN);
+    delay_high();                             // tHD;STA
+    PORTB &= ~(1 << SCL_PIN);
+    PORTB |= (1 << SDA_PIN);                  // hand SDA to USIDR
+    return true;
+}
+
+inline bool bus_stop() {
+    PORTB &= ~(1 << SDA_PIN);
+    PORTB |= (1 << SCL_PIN);
+    bool ok = scl_settle();
+    delay_high();                             // tSU;STO
+    PORTB |= (1 << SDA_PIN);
+    delay_low();                              // tBUF before the next START
+    return ok;
+}
+
+// --- Asynchronous transmit ---
+//
+// Timer0 runs in CTC mode at twice I2C_ASYNC_SCL_HZ and its compare ISR
+// strobes USITC, i.e. toggles SCL. The USI counter overflows after a byte
+// (16 edges) or an ACK (2 edges); the overflow ISR then loads the next
+// byte, samples the ACK, or ends the transfer. In the two-wire mode used
+// here (USIWM = 10) the overflow does not hold SCL low, and the counter
+// counts strobes, not the line: the overflow ISR has to restart Timer0
+// (timer_rephase(), its first store) before the next compare strobes SCL,
+// or that edge is clocked with SDA still holding the previous bit.
+
+constexpr uint8_t ASYNC_OCR = uint8_t(F_CPU / (2 * I2C_ASYNC_SCL_HZ) - 1);
+static_assert(F_CPU / (2 * I2C_ASYNC_SCL_HZ) - 1 <= 0xFF, "I2C_ASYNC_SCL_HZ too low for Timer0 at clk/1");
+
+// Worst case from the overflow to the end of timer_rephase(), estimated
+// from the instruction sequence: a TIMER0_COMPA ISR being serviced (10),
+// wake-up from idle sleep (4), interrupt response (4), the overflow ISR's
+// register-saving prologue (~24) and timer_rephase() itself (4). Every other
+// vector outranks USI_OVF, so nothing else may run in between: the pin
+// change and watchdog interrupts are masked while a transfer is on the bus
+// (mask_events()), and no other interrupt source is enabled.
+constexpr uint16_t OVF_LATENCY_CYCLES = 46;
+static_assert(F_CPU / (2 * I2C_ASYNC_SCL_HZ) > OVF_LATENCY_CYCLES,
+              "I2C_ASYNC_SCL_HZ too high: the USI overflow ISR cannot restart Timer0 before its next strobe");
+
+struct Transfer {
+    const uint8_t *data;
+    I2C::Callback done;
+    uint8_t addr7;
+    uint8_t len;
+};
+
+constexpr uint8_t QUEUE_MASK = I2C_QUEUE_LEN - 1;
+static_assert((I2C_QUEUE_LEN & QUEUE_MASK) == 0, "I2C_QUEUE_LEN must be a power of two");
+
+Transfer queue[I2C_QUEUE_LEN];
+volatile uint8_t q_head;                      // next transfer to run
+volatile uint8_t q_tail;                      // next free slot
+uint8_t pos;                                  // data bytes sent so far
+bool in_ack;                                  // counter is clocking the ACK bit
+
+inline void timer_start() {
+    TCCR0A = (1 << WGM01);                    // CTC
+    OCR0A = ASYNC_OCR;
+    TCNT0 = 0;
+    TIFR = (1 << OCF0A);
+    TIMSK |= (1 << OCIE0A);
+    TCCR0B = (1 << CS00);
+}
+
+inline void timer_stop() {
+    TCCR0B = 0;
+    TIMSK &= ~(1 << OCIE0A);
+}
+
+// Restart the half-period at the top of the overflow ISR: the pending
+// strobe is dropped and the next one comes a full half-period later, after
+// the ISR has set up SDA.
+inline void timer_rephase() {
+    TCNT0 = 0;
+    TIFR = (1 << OCF0A);
+}
+
+// PCIE and WDIE as found when the transfer started
+uint8_t events_enabled;
+
+// Hold off the pin change and watchdog interrupts, the ones the watch uses.
+// Their flags still get set, so each fires once when unmask_events() runs.
+// WDIF is cleared by writing one: write it back as zero.
+inline void mask_events() {
+    events_enabled = (GIMSK & (1 << PCIE)) | (WDTCR & (1 << WDIE));
+    GIMSK &= ~(1 << PCIE);
+    WDTCR = WDTCR & ~((1 << WDIE) | (1 << WDIF));
+}
+
+inline void unmask_events() {
+    GIMSK |= events_enabled & (1 << PCIE);
+    if (events_enabled & (1 << WDIE)) WDTCR = (WDTCR & ~(1 << WDIF)) | (1 << WDIE);
+}
+
+void async_end(bool ok);
+
+// Issue START + address for the transfer at q_head. Interrupts are off.
+// The Timer0 strobes do not wait for a stretched SCL; only the START does.
+void async_begin() {
+    const Transfer &t = queue[q_head];
+    mask_events();
+    if (!bus_start()) {
+        async_end(false);
+        return;
+    }
+    USIDR = uint8_t(t.addr7 << 1);
+    pos = 0;
+    in_ack = false;
+    USICR = USICR_TWI | (1 << USIOIE);
+    USISR = USISR_8BIT;
+    timer_start();
+}
+
+void async_end(bool ok) {
+    timer_stop();
+    USICR = USICR_TWI;
+    bus_stop();
+    unmask_events();
+    I2C::Callback done = queue[q_head].done;
+    q_head = (q_head + 1) & QUEUE_MASK;
+    if (done) done(ok);
+    if (q_head != q_tail) async_begin();
+}
+
+} // namespace
+
+ISR(TIMER0_COMPA_vect, ISR_NAKED) {
+    // sbi leaves SREG alone, so no prologue is needed.
+    asm volatile(
+        "sbi %0, %1\n\t"
+        "reti\n\t"
+        :: "I" (_SFR_IO_ADDR(USICR)), "I" (USITC));
+}
+
+ISR(USI_OVF_vect) {
+    timer_rephase();
+    if (!in_ack) {
+        DDRB &= ~(1 << SDA_PIN);              // let the slave drive ACK
+        in_ack = true;
+        USISR = USISR_1BIT;
+        return;
+    }
+    bool ack = (USIDR & 0x01) == 0;
+    USIDR = 0xFF;
+    DDRB |= (1 << SDA_PIN);
+    in_ack = false;
+    const Transfer &t = queue[q_head];
+    if (ack && pos < t.len) {
+        USIDR = t.data[pos++];
+        USISR = USISR_8BIT;
+        return;
+    }
+    async_end(ack);
+}
+
+bool I2C::writeAsync(uint8_t addr7, const uint8_t *data, uint8_t len, Callback done) {
+    uint8_t sreg = SREG;
+    cli();
+    uint8_t next = (q_tail + 1) & QUEUE_MASK;
+    if (next == q_head) {
+        SREG = sreg;
+        return false;
+    }
+    bool idle = (q_head == q_tail);
+    Transfer &t = queue[q_tail];
+    t.data = data;
+    t.done = done;
+    t.addr7 = addr7;
+    t.len = len;
+    q_tail = next;
+#if I2C_STATS
+    I2C::byteCount += len + 1;
+#endif
+    if (idle) async_begin();
+    SREG = sreg;
+    return true;
+}
+
+bool I2C::busy() {
+    return q_head != q_tail;
+}
+
+// Leaves the interrupt flag as it found it. Waiting itself needs the
+// interrupts, so they are on while it sleeps.
+void I2C::flush(uint8_t pending) {
+    uint8_t sreg = SREG;
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    for (;;) {
+        cli();
+        if (((q_tail - q_head) & QUEUE_MASK) <= pending) break;
+        sleep_enable();
+        sei();                                // executes before any ISR runs,
+        sleep_cpu();                          // so no wakeup is lost
+        sleep_disable();
+    }
+    SREG = sreg;
+}
+
+void I2C::begin() {
+    PORTB |= (1 << SDA_b) | (1 << SCL_b); // released; USI pulls low as needed
+    DDRB  |= (1 << SDA_b) | (1 << SCL_b);
+    USIDR = 0xFF;
+    USICR = USICR_TWI;
+    USISR = USISR_8BIT;
+}
+
+// Private
+
+// Clock out (or in) the number of edges preloaded in `status`, honouring
+// clock stretching: SCL is checked at the end of the high half, after the
+// pull-up had time to raise it. Returns the shifted-in USIDR; a stretch
+// timeout leaves SCL released and error_ set.
+uint8_t I2C::usi_transfer(uint8_t status) {
+    USISR = status;
+    do {
+        delay_low();
+        USICR = USICR_TWI | (1 << USITC);     // SCL high
+        delay_high();
+        if (!(PINB & (1 << SCL_b)) && !scl_wait()) break; // stretching
+        USICR = USICR_TWI | (1 << USITC);     // SCL low
+    } while (!(USISR & (1 << USIOIF)));
+    delay_low();
+    uint8_t data = USIDR;
+    USIDR = 0xFF;                             // release SDA
+    DDRB |= (1 << SDA_b);
+    return data;
+}
+
+bool I2C::scl_wait() {
+    if (scl_settle()) return true;
+    error_ = ERROR_TIMEOUT;
+    return false;
+}
+
+bool I2C::start_condition() {
+    while (busy());                           // let queued transfers finish
+    PORTB |= (1 << SCL_b);
+    if (!scl_wait()) return false;
+    if (!(PINB & (1 << SDA_b)) && !recover()) return false;
+    if (!bus_start()) {
+        error_ = ERROR_TIMEOUT;
+        return false;
+    }
+    return true;
+}
+
+void I2C::stop_condition() {
+    if (!bus_stop() && error_ == ERROR_NONE) error_ = ERROR_TIMEOUT;
+}
+
+// Nine SCL pulses by hand (PORTB), with USIDR released
+bool I2C::recover() {
+    USIDR = 0xFF;
+    PORTB |= (1 << SDA_b);
+    for (uint8_t i = 0; i < 9 && !(PINB & (1 << SDA_b)); ++i) {
+        PORTB &= ~(1 << SCL_b);
+        delay_low();
+        PORTB |= (1 << SCL_b);
+        delay_high();
+        if (!scl_wait()) return false;
+    }
+    if (!(PINB & (1 << SDA_b))) {
+        error_ = ERROR_BUS_STUCK;
+        return false;
+    }
+    PORTB &= ~(1 << SCL_b);
+    delay_low();
+    if (!bus_stop()) {                        // earlier errors do not count
+        error_ = ERROR_TIMEOUT;
+        return false;
+    }
+    return true;
+}
+
+bool I2C::write_byte(uint8_t b) {
+    USIDR = b;
+    usi_transfer(USISR_8BIT);
+    if (error_ != ERROR_NONE) return false;
+    DDRB &= ~(1 << SDA_b);                    // SDA input for ACK
+    bool ack = (usi_transfer(USISR_1BIT) & 0x01) == 0;
+    return ack && error_ == ERROR_NONE;
+}
+
+uint8_t I2C::read_byte(bool ack) {
+    DDRB &= ~(1 << SDA_b);
+    uint8_t b = usi_transfer(USISR_8BIT);
+    USIDR = ack ? 0x00 : 0xFF;
+    usi_transfer(USISR_1BIT);
+    return b;
+}
+
+#endif // I2C_BACKEND == I2C_BACKEND_USI
@@ -1,18 +1,216 @@
-#include <Arduino.h>
+// Watch firmware for the ATtiny85 ([env:attiny85]).
+//
+// Tickless event loop: the chip sits in SLEEP_MODE_PWR_DOWN (brown-out
+// detector off during sleep) and only wakes for
+// - the watchdog interrupt, about once per second (timekeeping, clock.h),
+// - a pin change on the buttons: PB1 advances the hour, PB3 the minute.
+// There is no Arduino core and so no Timer0 millis() interrupt; Timer0,
+// Timer1 and the ADC stay powered down (I2C::writeAsync() needs Timer0, so
+// call power_timer0_enable() before using it; OLED_PIPELINE builds keep it).
+// The panel is only updated for the digits Clock reports as changed, i.e.
+// once a minute, in bounded steps with the events checked in between.
+//
+// With WATCH_ANIMATE=1 a minute change first slides the old minute digit
+// out with the panel's hardware scroll for one tick, at no CPU cost, and the
+// new digit is drawn at the next tick (or button press). Build with
+// OLED_SCROLL_COLUMNS=1 if the controller supports it, otherwise the whole
+// face slides.
+//
+// Pins: PB0 SDA, PB2 SCL, PB1/PB3 buttons to GND (internal pull-ups),
+// PB4 unused (pulled up so it does not float).
 
-// put function declarations here:
-int myFunction(int, int);
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <avr/power.h>
+#include <avr/sleep.h>
+#include <stdint.h>
 
-void setup() {
-  // put your setup code here, to run once:
-  int result = myFunction(2, 3);
+#include "GME12864_OLED.h"
+#include "clock.h"
+#include "i2c.h"
+#include "screen_images.h"
+
+// Display power profile while the watch runs (GME12864_OLED::PowerProfile)
+#ifndef WATCH_POWER_PROFILE
+#define WATCH_POWER_PROFILE GME12864_OLED::POWER_NORMAL
+#endif
+
+// 1 to scan only the face's rows (screen_ink) instead of all 64. Off until
+// checked on a real panel: init() selects the alternative COM pin layout
+// (0xDA 0x12), and whether the rows stay in place with a reduced multiplex
+// ratio there has only been checked against the host model.
+#ifndef WATCH_USED_ROWS
+#define WATCH_USED_ROWS 0
+#endif
+
+// Data bytes per display flush step: the longest the main loop goes
+// without looking at events while a frame is being sent (bench scenario
+// flush_step, built with BENCH_FLUSH_STEP set to the same value)
+#ifndef WATCH_FLUSH_STEP
+#define WATCH_FLUSH_STEP 64
+#endif
+
+#ifndef WATCH_ANIMATE
+#define WATCH_ANIMATE 0
+#endif
+
+static constexpr uint8_t BTN_HOUR   = PB1;
+static constexpr uint8_t BTN_MINUTE = PB3;
+static constexpr uint8_t BTN_MASK   = (1 << BTN_HOUR) | (1 << BTN_MINUTE);
+
+// Events set by the ISRs and consumed by the main loop
+static constexpr uint8_t EV_TICK   = 0x01;
+static constexpr uint8_t EV_BUTTON = 0x02;
+static volatile uint8_t events;
+
+ISR(WDT_vect) {
+    events |= EV_TICK;
+}
+
+ISR(PCINT0_vect) {
+    events |= EV_BUTTON;
+}
+
+static const oled_canvas *digit(uint8_t d) {
+    return (const oled_canvas *)pgm_read_ptr(&number_canvases[d]);
+}
+
+static GME12864_OLED oled;
+static GME12864_OLED::SceneItem face[] = {
+    { &hour_tens,   &number_num_0 },
+    { &hour_ones,   &number_num_0 },
+    { &colon,       &colon_char_colon },
+    { &minute_tens, &number_num_0 },
+    { &minute_ones, &number_num_0 },
+};
+
+// Clock changes held back while a scroll animation runs
+static uint8_t pending;
+
+// Redraw the digits in `changed` (a Clock mask) and any pending ones
+static void showTime(uint8_t changed) {
+    changed |= pending;
+    pending = 0;
+    uint8_t h = Clock::hours(), m = Clock::minutes();
+    if (!(changed & (Clock::MINUTE | Clock::HOUR))) return;
+    if (changed & Clock::HOUR_TENS)   oled.setCanvas(0, digit(h / 10));
+    if (changed & Clock::HOUR_ONES)   oled.setCanvas(1, digit(h % 10));
+    if (changed & Clock::MINUTE_TENS) oled.setCanvas(3, digit(m / 10));
+    if (changed & Clock::MINUTE_ONES) oled.setCanvas(4, digit(m % 10));
+    oled.beginFlush(); // the main loop sends the frame in steps
 }
 
-void loop() {
-  // put your main code here, to run repeatedly:
+// A tick's changes: start the scroll for a plain minute step and draw the
+// digit one tick later, anything else right away.
+static void onTick(uint8_t changed) {
+    if (WATCH_ANIMATE && !pending && (changed & ~Clock::SECOND) == Clock::MINUTE_ONES
+        && oled.startScroll(&minute_ones, GME12864_OLED::SCROLL_LEFT,
+                            GME12864_OLED::SCROLL_2_FRAMES)) {
+        pending = changed;
+        return;
+    }
+    showTime(changed);
 }
 
-// put function definitions here:
-int myFunction(int x, int y) {
-  return x + y;
-}
\ No newline at end of file
+static void setupPower() {
+    ACSR |= (1 << ACD);                       // analog comparator off
+    ADCSRA = 0;
+    power_adc_disable();
+#if !OLED_PIPELINE                            // the strip pipeline clocks the bus with Timer0
+    power_timer0_disable();
+#endif
+    power_timer1_disable();
+    PORTB |= BTN_MASK | (1 << PB4);           // pull-ups: buttons, unused pin
+}
+
+static void setupButtons() {
+    PCMSK = BTN_MASK;
+    GIFR = (1 << PCIF);
+    GIMSK |= (1 << PCIE);
+}
+
+// Returns the pending events; with `sleep`, powers down until there is one.
+// Events are checked with interrupts off and sei() takes effect after the
+// following instruction, so an event raised in between is not slept through.
+static uint8_t waitEvents(bool sleep) {
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    for (;;) {
+        cli();
+        uint8_t ev = events;
+        if (ev || !sleep) {
+            events = 0;
+            sei();
+            return ev;
+        }
+        sleep_enable();
+#if defined(BODS) && defined(BODSE)
+        sleep_bod_disable();
+#endif
+        sei();
+        sleep_cpu();
+        sleep_disable();
+    }
+}
+
+// Buttons act on the press edge. A pressed button's pin change interrupt
+// stays masked until a tick sees it released, which debounces it; while it
+// is held, every tick repeats it.
+static uint8_t held;
+
+static void applyButtons(uint8_t pressed) {
+    uint8_t h = Clock::hours(), m = Clock::minutes(), s = Clock::seconds();
+    if (pressed & (1 << BTN_HOUR)) {
+        if (++h == 24) h = 0;
+    }
+    if (pressed & (1 << BTN_MINUTE)) {
+        if (++m == 60) m = 0;
+        s = 0;
+    }
+    showTime(Clock::set(h, m, s));
+}
+
+static void onButtons() {
+    uint8_t pressed = ~PINB & BTN_MASK & ~held;
+    if (!pressed) return;
+    held |= pressed;
+    PCMSK &= ~pressed;
+    applyButtons(pressed);
+}
+
+static void onButtonsTick() {
+    uint8_t released = held & PINB;
+    held &= ~released;
+    PCMSK |= released;
+    if (held) applyButtons(held);
+}
+
+int main() {
+    setupPower();
+    I2C::begin();
+    oled.init();
+#if WATCH_USED_ROWS
+    oled.setUsedRows(screen_ink.y, screen_ink.height);
+#endif
+    oled.setPowerProfile(WATCH_POWER_PROFILE);
+    oled.setTransitions(screen_transitions, SCREEN_TRANSITION_COUNT);
+    oled.setScene(face, sizeof(face) / sizeof(face[0]));
+    oled.update();
+    setupButtons();
+    Clock::begin();
+    sei();
+
+    bool flushing = false;
+    for (;;) {
+        uint8_t ev = waitEvents(!flushing);
+        if (ev & EV_TICK) {
+            onButtonsTick();
+            onTick(Clock::tick());
+        }
+        if (ev & EV_BUTTON) onButtons();
+
+        // The frame goes out WATCH_FLUSH_STEP data bytes at a time with the
+        // events checked in between. After a failed step the watch sleeps
+        // and retries at the next tick; pages already sent stay sent.
+        flushing = !oled.done() && oled.step(WATCH_FLUSH_STEP) && !oled.done();
+    }
+}
@@ -0,0 +1,376 @@
+// Host-side watch face simulation ([env:native]).
+//
+// Drives GME12864_OLED over the simulated I2C bus into an SSD1306 model,
+// prints the bus traffic of each frame and checks the model's GDDRAM against
+// a reference rendered with displayCanvas(). Every step also has a budget of
+// bus bytes and transactions (what the default build sends today), so
+// `pio run -e native -t exec` exits non-zero on a pixel mismatch or on a
+// change that sends more than before: a pixel and transfer-volume gate.
+// The framebuffer build (OLED_FRAMEBUFFER, [env:native_framebuffer]) runs
+// its own shorter list: text, a full face and digit redraws.
+// Also reads a register burst from a simulated RTC-like slave, checking the
+// combined write/read transaction of the I2C layer, and injects bus faults
+// to check the error codes, the bus clear and the retry after each.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "GME12864_OLED.h"
+#include "i2c.h"
+#include "screen_images.h"
+#include "sim_bus.h"
+#include "sim_registers.h"
+#include "ssd1306_model.h"
+
+static const oled_canvas *digit(uint8_t d) {
+    return (const oled_canvas *)pgm_read_ptr(&number_canvases[d]);
+}
+
+#if !OLED_FRAMEBUFFER
+// The real assets have no transitions that beat redrawing the ink (the
+// table in screen_images.h is empty), so the delta-window paths run on a
+// synthetic table instead: each digit split into a top and a bottom half,
+// which covers every byte that can differ.
+static const oled_window halves[2] PROGMEM = {
+    { 0, 27, 0, 3 }, { 0, 27, 4, 7 }
+};
+static const oled_transition synthetic[2] PROGMEM = {
+    { &number_num_0, &number_num_1, halves, 2 },
+    { &number_num_1, &number_num_2, halves, 2 }
+};
+
+// A digit off the page grid and cut short by its region, so composed strips
+// and the reference both have to shift and clip it
+static const region low PROGMEM = { .x = 50, .y = 5, .width = 28, .height = 59 };
+static GME12864_OLED::SceneItem lowScene[] = {
+    { &low, &number_num_8 },
+};
+#endif
+
+static SSD1306Model panel;
+static GME12864_OLED oled;
+static oled_screen ref = { 128, 64, {} };
+
+#if OLED_FRAMEBUFFER
+// Every digit and the colon are drawn again, so each frame resends the face
+static void setTime(uint8_t h, uint8_t m) {
+    oled.drawCanvas(&hour_tens, digit(h / 10));
+    oled.drawCanvas(&hour_ones, digit(h % 10));
+    oled.drawCanvas(&colon, &colon_char_colon);
+    oled.drawCanvas(&minute_tens, digit(m / 10));
+    oled.drawCanvas(&minute_ones, digit(m % 10));
+}
+#else
+static GME12864_OLED::SceneItem face[] = {
+    { &hour_tens,   &number_num_0 },
+    { &hour_ones,   &number_num_0 },
+    { &colon,       &colon_char_colon },
+    { &minute_tens, &number_num_0 },
+    { &minute_ones, &number_num_0 },
+};
+
+static void setTime(uint8_t h, uint8_t m) {
+    oled.setCanvas(0, digit(h / 10));
+    oled.setCanvas(1, digit(h % 10));
+    oled.setCanvas(3, digit(m / 10));
+    oled.setCanvas(4, digit(m % 10));
+}
+#endif
+
+// Compare the panel's GDDRAM with the reference buffer
+static bool shows(const oled_screen &screen) {
+    for (uint8_t x = 0; x < 128; ++x) {
+        for (uint8_t page = 0; page < 8; ++page) {
+            if (panel.ram(page, x) != screen.buffer[x * 8 + page]) return false;
+        }
+    }
+    return true;
+}
+
+// The same with the face rendered into the reference buffer
+static bool matches(uint8_t h, uint8_t m) {
+    memset(ref.buffer, 0, sizeof(ref.buffer));
+    displayCanvas(&ref, &hour_tens, digit(h / 10));
+    displayCanvas(&ref, &hour_ones, digit(h % 10));
+    displayCanvas(&ref, &colon, &colon_char_colon);
+    displayCanvas(&ref, &minute_tens, digit(m / 10));
+    displayCanvas(&ref, &minute_ones, digit(m % 10));
+    return shows(ref);
+}
+
+// "12:" in the 5x7 font, written out by hand from the glyphs: five columns
+// and the blank advance column per character
+static const uint8_t text12[18] = {
+    0x00, 0x42, 0x7F, 0x40, 0x00, 0x00,
+    0x42, 0x61, 0x51, 0x49, 0x46, 0x00,
+    0x00, 0x36, 0x36, 0x00, 0x00, 0x00
+};
+
+// The first `cols` columns of text12 at (x, y) on the panel; rows of the
+// touched pages outside the glyphs must be clear
+static bool showsText(uint8_t x, uint8_t y, uint8_t cols) {
+    uint8_t sh = y & 7, page = y / 8;
+    for (uint8_t i = 0; i < cols; ++i) {
+        if (panel.ram(page, x + i) != uint8_t(text12[i] << sh)) return false;
+        if (sh > 1 && panel.ram(page + 1, x + i) != uint8_t(text12[i] >> (8 - sh))) return false;
+    }
+    return true;
+}
+
+// Bus traffic since the last SimBus::clearStats() against a budget. Lower
+// is fine (update the budget to lock the gain in), higher fails the run.
+struct Budget {
+    uint16_t bytes;
+    uint8_t transactions;
+};
+
+static bool within(const Budget &b) {
+    const SimBus::Stats &s = SimBus::stats();
+    return s.bytes <= b.bytes && s.transactions <= b.transactions;
+}
+
+static const char *verdict(bool ok, const Budget &b) {
+    if (!ok) return "MISMATCH";
+    return within(b) ? "ok" : "OVER BUDGET";
+}
+
+// Report a step the caller ran since SimBus::clearStats()
+static bool checked(const char *name, bool ok, Budget budget) {
+    const SimBus::Stats &s = SimBus::stats();
+    printf("%-22s        %5u bytes  %3u transactions  %4u data  %s\n",
+           name, unsigned(s.bytes), unsigned(s.transactions),
+           unsigned(panel.dataBytes()), verdict(ok, budget));
+    return ok && within(budget);
+}
+
+static bool frame(const char *name, uint8_t h, uint8_t m, Budget budget) {
+    SimBus::clearStats();
+    panel.clearCounters();
+    setTime(h, m);
+    bool ok = oled.update() && matches(h, m);
+    const SimBus::Stats &s = SimBus::stats();
+    printf("%-22s %02u:%02u  %5u bytes  %3u transactions  %4u data  %s\n",
+           name, h, m, unsigned(s.bytes), unsigned(s.transactions),
+           unsigned(panel.dataBytes()), verdict(ok, budget));
+    return ok && within(budget);
+}
+
+#if !OLED_FRAMEBUFFER
+// The same in steps of at most `budget` data bytes, with the panel
+// unplugged for the third step: that step fails and is retried, the rest of
+// the frame is not resent.
+static bool stepped(const char *name, uint8_t h, uint8_t m, uint16_t budget, Budget limit) {
+    SimBus::clearStats();
+    panel.clearCounters();
+    setTime(h, m);
+    bool ok = oled.beginFlush();
+    unsigned steps = 0, failed = 0;
+    for (; ok && !oled.done() && steps < 100; ++steps) {
+        if (steps == 2) SimBus::detach(0x3C);
+        if (!oled.step(budget)) ++failed;
+        if (steps == 2) SimBus::attach(0x3C, &panel);
+    }
+    ok = ok && oled.done() && failed == 1 && matches(h, m);
+    const SimBus::Stats &s = SimBus::stats();
+    printf("%-22s %02u:%02u  %5u bytes  %3u transactions  %4u data  %s (%u steps of %u)\n",
+           name, h, m, unsigned(s.bytes), unsigned(s.transactions),
+           unsigned(panel.dataBytes()), verdict(ok, limit), steps, unsigned(budget));
+    return ok && within(limit);
+}
+#endif
+
+// A 7-register burst from an RTC-like register file in one combined
+// transaction: pointer write, repeated START, read, one STOP.
+static bool burstRead() {
+    static SimRegisters rtc;
+    for (uint8_t i = 0; i < 7; ++i) rtc.regs[0x10 + i] = uint8_t(0xA0 + i);
+    SimBus::attach(0x68, &rtc);
+    SimBus::clearStats();
+    uint8_t buf[7] = {};
+    bool ok = I2C::readRegisters(0x68, 0x10, buf, sizeof(buf));
+    for (uint8_t i = 0; i < sizeof(buf); ++i) ok &= buf[i] == 0xA0 + i;
+    const SimBus::Stats &s = SimBus::stats();
+    ok &= s.transactions == 2 && s.stops == 1 && s.bytes == 3 + sizeof(buf);
+    printf("%-22s        %5u bytes  %3u transactions  %4u stops %s\n", "register burst",
+           unsigned(s.bytes), unsigned(s.transactions), unsigned(s.stops), ok ? "ok" : "FAILED");
+    SimBus::detach(0x68);
+    return ok;
+}
+
+// Run a frame with a fault injected by the caller: the frame must end with
+// `expect` (ERROR_NONE: the START cleared the bus by itself), then redraw
+// correctly once the fault is gone.
+static bool fault(const char *name, uint8_t h, uint8_t m, I2C::Error expect) {
+    SimBus::clearStats();
+    setTime(h, m);
+    bool first = oled.update();
+    I2C::Error error = I2C::lastError();
+    uint32_t clocks = SimBus::stats().clocks;
+    SimBus::clearFaults();
+    SimBus::attach(0x3C, &panel);
+    bool ok = first == (expect == I2C::ERROR_NONE) && error == expect
+        && oled.update() && matches(h, m);
+    printf("%-22s %02u:%02u  error %u  %2u clocks                    %s\n",
+           name, h, m, unsigned(error), unsigned(clocks), ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main() {
+    SimBus::attach(0x3C, &panel);
+    I2C::begin();
+
+#if OLED_FRAMEBUFFER
+    bool ok = oled.init();
+    printf("%-22s        %5u bytes  %3u transactions                  %s\n", "init",
+           unsigned(SimBus::stats().bytes), unsigned(SimBus::stats().transactions),
+           verdict(ok, { 1063, 3 }));
+    ok &= within({ 1063, 3 });
+
+    // Text into the buffer, page-aligned and shifted, then one flush
+    SimBus::clearStats();
+    panel.clearCounters();
+    oled.drawString(0, 0, "12:");
+    oled.drawString(40, 20, "12:");
+    oled.drawChar5x7(90, 41, '1', true);
+    bool text = oled.update() && showsText(0, 0, 18) && showsText(40, 20, 18)
+        && showsText(90, 41, 5);
+    ok &= checked("text", text, { 86, 6 });
+
+    oled.clear();
+    ok &= frame("full frame", 12, 58, { 1034, 2 });
+    oled.setPixel(127, 63, true);
+    SimBus::clearStats();
+    panel.clearCounters();
+    ok &= checked("pixel", oled.update() && panel.pixel(127, 63), { 11, 2 });
+    oled.setPixel(127, 63, false);
+    ok &= frame("pixel cleared", 12, 59, { 1034, 2 });
+#else
+    bool ok = oled.init();
+    printf("%-22s        %5u bytes  %3u transactions                  %s\n", "init",
+           unsigned(SimBus::stats().bytes), unsigned(SimBus::stats().transactions),
+           verdict(ok, { 1123, 34 }));
+    ok &= within({ 1123, 34 });
+
+    oled.setTransitions(screen_transitions, SCREEN_TRANSITION_COUNT);
+    oled.setScene(face, sizeof(face) / sizeof(face[0]));
+    ok &= frame("full frame", 12, 58, { 1059, 34 });
+    ok &= frame("one digit", 12, 59, { 224, 9 });
+    ok &= frame("minute rollover", 13, 0, { 848, 33 });
+    ok &= frame("hour rollover", 20, 0, { 454, 18 });
+    ok &= frame("no change", 20, 0, { 0, 0 });
+    ok &= stepped("stepped rollover", 21, 59, 64, { 1150, 116 });
+    ok &= frame("after steps", 20, 0, { 853, 33 });
+
+    // Delta windows from a transition table, through setCanvas() and
+    // blit(previous); blitting back has no transition and sends the ink
+    oled.setTransitions(synthetic, 2);
+    ok &= frame("transition windows", 20, 1, { 248, 9 });
+    SimBus::clearStats();
+    bool blitted = oled.blit(&minute_ones, digit(2), digit(1)) && matches(20, 2);
+    printf("%-22s %02u:%02u  %5u bytes  %3u transactions             %s\n", "blit transition",
+           20u, 2u, unsigned(SimBus::stats().bytes), unsigned(SimBus::stats().transactions),
+           verdict(blitted, { 246, 4 }));
+    ok &= blitted && within({ 246, 4 });
+    SimBus::clearStats();
+    blitted = oled.blit(&minute_ones, digit(1), digit(2)) && matches(20, 1);
+    printf("%-22s %02u:%02u  %5u bytes  %3u transactions             %s\n", "blit ink",
+           20u, 1u, unsigned(SimBus::stats().bytes), unsigned(SimBus::stats().transactions),
+           verdict(blitted, { 202, 2 }));
+    ok &= blitted && within({ 202, 2 });
+    oled.setTransitions(screen_transitions, SCREEN_TRANSITION_COUNT);
+
+    // The panel scrolls on its own; the next update() stops it and redraws
+    // the scrolled pages with the final digit (and switches back from the
+    // vertical addressing blit() left behind).
+    SimBus::clearStats();
+    bool scrolled = oled.startScroll(&minute_ones, GME12864_OLED::SCROLL_LEFT,
+                                     GME12864_OLED::SCROLL_2_FRAMES)
+        && panel.scroll().active;
+    printf("%-22s        %5u bytes  %3u transactions             %s\n", "scroll start",
+           unsigned(SimBus::stats().bytes), unsigned(SimBus::stats().transactions),
+           scrolled ? verdict(true, { 11, 1 }) : "FAILED");
+    ok &= scrolled && within({ 11, 1 });
+    ok &= frame("scroll stop", 20, 1, { 1101, 34 }) && !panel.scroll().active;
+
+    // Dim profile on the face's rows, off with RAM kept, back on
+    oled.setUsedRows(screen_ink.y, screen_ink.height);
+    SimBus::clearStats();
+    bool dim = oled.setPowerProfile(GME12864_OLED::POWER_DIM)
+        && panel.multiplex() == screen_ink.height - 1 && panel.startLine() == screen_ink.y
+        && panel.contrast() == 0x01 && panel.displayOn();
+    printf("%-22s        %5u bytes  %3u transactions             %s\n", "dim profile",
+           unsigned(SimBus::stats().bytes), unsigned(SimBus::stats().transactions),
+           dim ? verdict(true, { 18, 1 }) : "FAILED");
+    dim &= within({ 18, 1 });
+    bool off = oled.setPowerProfile(GME12864_OLED::POWER_OFF)
+        && !panel.displayOn() && !panel.chargePump()
+        && oled.setPowerProfile(GME12864_OLED::POWER_NORMAL)
+        && panel.displayOn() && panel.chargePump() && matches(20, 1);
+    printf("%-22s                                               %s\n", "off and back",
+           off ? "ok" : "FAILED");
+    ok &= dim && off;
+
+    // Spans under the controller's 16-row minimum are widened around their
+    // middle, and kept on the panel
+    oled.setUsedRows(60, 8);
+    bool rows = oled.setPowerProfile(GME12864_OLED::POWER_NORMAL)
+        && panel.multiplex() == 15 && panel.startLine() == 48;
+    oled.setUsedRows(20, 4);
+    rows = rows && oled.setPowerProfile(GME12864_OLED::POWER_NORMAL)
+        && panel.multiplex() == 15 && panel.startLine() == 14;
+    oled.setUsedRows(0, GME12864_OLED::HEIGHT);
+    rows = rows && oled.setPowerProfile(GME12864_OLED::POWER_NORMAL)
+        && panel.multiplex() == 63 && panel.startLine() == 0 && matches(20, 1);
+    printf("%-22s                                               %s\n", "short row spans",
+           rows ? "ok" : "FAILED");
+    ok &= rows;
+#endif
+    ok &= burstRead();
+
+    SimBus::nackByte(100);
+    ok &= fault("data NACK", 20, 2, I2C::ERROR_NACK_DATA);
+    SimBus::detach(0x3C);
+    ok &= fault("panel missing", 20, 3, I2C::ERROR_NACK_ADDRESS);
+    SimBus::holdScl(true);
+    ok &= fault("SCL held", 20, 4, I2C::ERROR_TIMEOUT);
+    SimBus::holdSda(5);
+    ok &= fault("SDA held 5 clocks", 20, 5, I2C::ERROR_NONE);
+    SimBus::holdSda(0xFF);
+    ok &= fault("SDA stuck", 20, 6, I2C::ERROR_BUS_STUCK);
+
+#if !OLED_FRAMEBUFFER
+    // A whole region straight from PROGMEM: exactly its 224 bytes of data
+    SimBus::clearStats();
+    panel.clearCounters();
+    ok &= checked("blit region", oled.blit(&hour_ones, digit(5)) && matches(25, 6)
+                  && panel.dataBytes() == 28 * 8, { 236, 2 });
+    SimBus::clearStats();
+    panel.clearCounters();
+    ok &= checked("blit back", oled.blit(&hour_ones, digit(0), digit(5)) && matches(20, 6),
+                  { 194, 2 });
+
+    // Text straight to the panel over the face, page-aligned and shifted,
+    // then the face redrawn over it
+    SimBus::clearStats();
+    panel.clearCounters();
+    bool text = oled.drawString(0, 0, "12:") && oled.drawString(40, 20, "12:")
+        && oled.drawChar5x7(90, 41, '1') && showsText(0, 0, 18) && showsText(40, 20, 18)
+        && showsText(90, 41, 6);
+    ok &= checked("text", text, { 90, 6 });
+    oled.invalidate();
+    ok &= frame("redraw over text", 20, 6, { 1098, 33 });
+
+    // Strips composed from a digit off the page grid
+    SimBus::clearStats();
+    panel.clearCounters();
+    oled.setScene(lowScene, 1);
+    memset(ref.buffer, 0, sizeof(ref.buffer));
+    displayCanvas(&ref, &low, &number_num_8);
+    ok &= checked("shifted scene", oled.update() && shows(ref), { 1008, 33 });
+    oled.setScene(face, sizeof(face) / sizeof(face[0]));
+    ok &= frame("face again", 20, 6, { 1008, 33 });
+#endif
+
+    panel.dump(stdout);
+    return ok ? 0 : 1;
+}
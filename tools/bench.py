@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+"""Run the ATtiny85 benchmark firmware under simavr and write a JSON report.
+
+    tools/bench.py [--env bench] [--no-build] [--out bench/<env>.json]
+
+Builds [env:bench] (or another bench env, e.g. bench_unrolled for the
+unrolled bit-bang backend) with PlatformIO unless --no-build, and
+tools/simavr_bench.c against libsimavr: simavr plus the I2C pull-ups and an
+ACKing SSD1306 at 0x3C, which the stock simavr binary lacks (there every
+transfer times out). Runs the ELF in it and combines two outputs of
+src/bench/bench_main.cpp:
+
+- the VCD trace of GPIOR1 (scenario id while a scenario runs), which gives
+  the cycles spent per scenario, and of SCL, which gives the achieved bus
+  clock (median SCL period within the scenario);
+- the console lines "BENCH <id> <name> <bytes> <ok|fail>", which give the
+  bus bytes and the result, and the closing "BENCH DONE <count>".
+
+The report lists cycles, bus bytes and awake time per scenario, plus the
+commit it was measured at, and the watch's awake fraction: a minute of
+ticks (minute_ticks) plus one digit redraw (one_digit) over 60 s of CPU
+clock. It goes to bench/<env>.json by default, one file
+per env, meant to be committed with the change it measures so the numbers
+can be diffed from commit to commit. Exits non-zero if a scenario failed or is
+missing, or simavr did not finish.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ENV = "bench"
+MCU = "attiny85"
+F_CPU = 8000000
+
+TIMESCALES = {"s": 1.0, "ms": 1e-3, "us": 1e-6, "ns": 1e-9, "ps": 1e-12, "fs": 1e-15}
+
+
+HARNESS_SRC = os.path.join(ROOT, "tools", "simavr_bench.c")
+HARNESS = os.path.join(ROOT, ".pio", "build", "simavr_bench")
+
+
+def build(env):
+    subprocess.run(["pio", "run", "-e", env], cwd=ROOT, check=True)
+
+
+def build_harness(cc, simavr_include, out):
+    """Compile tools/simavr_bench.c unless the binary is newer."""
+    if os.path.exists(out) and os.path.getmtime(out) >= os.path.getmtime(HARNESS_SRC):
+        return
+    os.makedirs(os.path.dirname(out), exist_ok=True)
+    subprocess.run([cc, "-O2", "-I" + simavr_include, HARNESS_SRC,
+                    "-lsimavr", "-lelf", "-o", out], check=True)
+
+
+def git_commit():
+    try:
+        out = subprocess.run(["git", "rev-parse", "--short", "HEAD"], cwd=ROOT,
+                             capture_output=True, text=True, check=True)
+        return out.stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def vcd_signal(text, symbol):
+    """Return [(seconds, value)] for each change of one VCD signal."""
+    scale = 1e-9
+    m = re.search(r"\$timescale\s+(\d+)\s*(\w+)\s+\$end", text)
+    if m:
+        scale = int(m.group(1)) * TIMESCALES[m.group(2)]
+    m = re.search(r"\$var\s+\S+\s+\d+\s+(\S+)\s+" + symbol + r"\s", text)
+    if not m:
+        raise ValueError("no '%s' signal in the VCD" % symbol)
+    ident = m.group(1)
+    changes = []
+    now = 0
+    body = text[text.find("$enddefinitions"):]
+    for line in body.splitlines():
+        line = line.strip()
+        if line.startswith("#"):
+            now = int(line[1:])
+            continue
+        m = re.match(r"b([01xz]+)\s+(\S+)$", line) or re.match(r"([01xz])(\S+)$", line)
+        if not m or m.group(2) != ident:
+            continue
+        bits = m.group(1)
+        value = 0 if re.search("[xz]", bits) else int(bits, 2)
+        changes.append((now * scale, value))
+    return changes
+
+
+def parse_vcd(path, symbol="scenario"):
+    """Return [(id, start_seconds, end_seconds)] for each non-zero span."""
+    with open(path) as f:
+        text = f.read()
+    spans = []
+    current, since = 0, 0
+    for now, value in vcd_signal(text, symbol):
+        if value == current:
+            continue
+        if current:
+            spans.append((current, since, now))
+        current, since = value, now
+    return spans
+
+
+def scl_releases(path, symbol="scl_low"):
+    """Times at which SCL was released (went high)."""
+    with open(path) as f:
+        text = f.read()
+    out, last = [], 0
+    for now, value in vcd_signal(text, symbol):
+        if last and not value:
+            out.append(now)
+        last = value
+    return out
+
+
+def scl_hz(releases, start, stop):
+    """Bus clock within [start, stop): from the median period between SCL
+    releases, so START/STOP and gaps between transfers do not count."""
+    times = [t for t in releases if start <= t < stop]
+    periods = sorted(b - a for a, b in zip(times, times[1:]))
+    if not periods:
+        return None
+    return round(1.0 / periods[len(periods) // 2])
+
+
+def parse_console(output):
+    """Scenario results by id, and the count from "BENCH DONE" (None if the
+    firmware never got there)."""
+    results = {}
+    for m in re.finditer(r"BENCH (\d+) (\S+) (\d+) (ok|fail)", output):
+        results[int(m.group(1))] = {
+            "name": m.group(2),
+            "bytes": int(m.group(3)),
+            "ok": m.group(4) == "ok",
+        }
+    m = re.search(r"BENCH DONE (\d+)", output)
+    return results, int(m.group(1)) if m else None
+
+
+def run(elf, harness, timeout):
+    with tempfile.TemporaryDirectory() as tmp:
+        proc = subprocess.run([harness, elf],
+                              cwd=tmp, capture_output=True, text=True, timeout=timeout)
+        output = proc.stdout + proc.stderr
+        vcd = os.path.join(tmp, "bench.vcd")
+        if proc.returncode != 0 or not os.path.exists(vcd):
+            sys.stderr.write(output)
+            raise RuntimeError("simavr_bench failed (exit %d) or wrote no bench.vcd"
+                               % proc.returncode)
+        results, done = parse_console(output)
+        return results, done, parse_vcd(vcd), scl_releases(vcd)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--env", default=ENV, help="PlatformIO bench environment")
+    ap.add_argument("--no-build", action="store_true", help="use the existing ELF")
+    ap.add_argument("--elf", help="default: .pio/build/<env>/firmware.elf")
+    ap.add_argument("--harness", default=HARNESS, help="simavr_bench binary")
+    ap.add_argument("--cc", default="cc", help="C compiler for the harness")
+    ap.add_argument("--simavr-include", default="/usr/include/simavr",
+                    help="simavr headers (sim_avr.h)")
+    ap.add_argument("--timeout", type=float, default=120.0, help="seconds")
+    ap.add_argument("--out", help="default: bench/<env>.json")
+    args = ap.parse_args()
+
+    elf = args.elf or os.path.join(ROOT, ".pio", "build", args.env, "firmware.elf")
+    out = args.out or os.path.join(ROOT, "bench", args.env + ".json")
+    if not args.no_build:
+        build(args.env)
+        if args.harness == HARNESS:
+            build_harness(args.cc, args.simavr_include, HARNESS)
+    console, done, spans, releases = run(elf, args.harness, args.timeout)
+
+    # Every scenario up to the firmware's own count must have reported and
+    # left a span; a run that stopped early fails here.
+    expected = set(range(1, done + 1)) if done else set()
+    ok = bool(expected) and set(console) == expected \
+        and sorted(sid for sid, _, _ in spans) == sorted(expected)
+    if not ok:
+        sys.stderr.write("expected scenarios 1..%s, got console %s and spans %s\n"
+                         % (done, sorted(console), sorted(sid for sid, _, _ in spans)))
+    scenarios = []
+    for sid, start, stop in spans:
+        info = console.get(sid)
+        if info is None:
+            ok = False
+            continue
+        cycles = round((stop - start) * F_CPU)
+        scenarios.append({
+            "id": sid,
+            "name": info["name"],
+            "cycles": cycles,
+            "bus_bytes": info["bytes"],
+            "cycles_per_byte": round(cycles / info["bytes"], 1) if info["bytes"] else None,
+            "awake_us": round(cycles * 1e6 / F_CPU, 1),
+            "scl_hz": scl_hz(releases, start, stop),
+            "ok": info["ok"],
+        })
+        ok &= info["ok"]
+
+    by_name = {s["name"]: s["cycles"] for s in scenarios}
+    awake = None
+    if "minute_ticks" in by_name and "one_digit" in by_name:
+        awake = (by_name["minute_ticks"] + by_name["one_digit"]) / (60.0 * F_CPU)
+
+    report = {
+        "commit": git_commit(),
+        "mcu": MCU,
+        "f_cpu": F_CPU,
+        "env": args.env,
+        "scenarios": scenarios,
+        "awake_fraction_per_minute": awake,
+    }
+    os.makedirs(os.path.dirname(os.path.abspath(out)), exist_ok=True)
+    with open(out, "w") as f:
+        json.dump(report, f, indent=2)
+        f.write("\n")
+
+    for s in scenarios:
+        print("%-16s %9d cycles %6d bytes %10.1f us %8s  %s"
+              % (s["name"], s["cycles"], s["bus_bytes"], s["awake_us"],
+                 "%d Hz" % s["scl_hz"] if s["scl_hz"] else "-", "ok" if s["ok"] else "FAIL"))
+    if awake is not None:
+        print("awake per minute: %.5f%%" % (awake * 100))
+    print("wrote %s" % os.path.relpath(out))
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,334 @@
+#!/usr/bin/env python3
+"""Compile an olEDitor project (JSON) into a PROGMEM header for the driver.
+
+    tools/oled_assets.py oled_project.json include/screen_images.h
+
+The project holds templates (a size plus canvases drawn at that size, as
+pixels[y][x] of 0/1) and regions (a named screen position showing one
+template). For every canvas the header gets:
+
+- <template>_<canvas>_data[]: the pixels in the driver's native order,
+  column-major, one byte per 8 rows (byte x * pages + y / 8, LSB = top),
+  i.e. what the SSD1306 takes in vertical addressing mode. Stored raw or,
+  when smaller, page-mask encoded (see OLED_ENC_PAGEMASK in oled_canvas.h).
+  Encoded canvases also get a raw copy, compiled instead when
+  OLED_ASSETS_RAW is 1, so the decoders can be timed against plain copies
+  ([env:bench_raw]);
+- <template>_<canvas>: the oled_canvas pointing at it, with the tight
+  bounding box of the set pixels as its ink extent.
+
+Per template, <template>_canvases[] (PROGMEM pointer table, in canvas
+order). For the transitions a
+counter makes (each canvas to the next, wrapping, and each canvas back to
+the first) <from>_to_<to>_delta[] lists the column/page windows where the
+two differ; screen_transitions[] collects those that beat sending the ink
+of both canvases (see oled_transition in oled_canvas.h). Per region, the
+PROGMEM region; screen_ink is the union of the canvas ink placed at the
+regions.
+
+The output only changes when the input does, so the PlatformIO pre-script
+(tools/pio_oled_assets.py) can run this on every build.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+ENCODINGS = {"raw": "OLED_ENC_RAW", "pagemask": "OLED_ENC_PAGEMASK"}
+
+# Bus bytes a window costs on top of its data: the command transfer
+# (address, control byte, 0x21 x0 x1 0x22 p0 p1) and the data transfer's
+# address and control byte, plus START/STOP counted as a byte each.
+WINDOW_OVERHEAD = 11
+
+# A transition is only emitted when its windows save at least this many bus
+# bytes over sending the ink of both canvases.
+DELTA_MIN_SAVING = 8
+
+
+def ident(name):
+    s = re.sub(r"\W", "_", name)
+    return "_" + s if s[:1].isdigit() else s
+
+
+def pack(pixels, w, h):
+    """pixels[y][x] -> column-major page bytes."""
+    pages = (h + 7) // 8
+    out = []
+    for x in range(w):
+        for p in range(pages):
+            b = 0
+            for bit in range(8):
+                y = p * 8 + bit
+                if y < h and pixels[y][x]:
+                    b |= 1 << bit
+            out.append(b)
+    return out
+
+
+def bbox(pixels, w, h):
+    """(x, y, width, height) of the set pixels; all zero for a blank canvas."""
+    xs = [x for x in range(w) if any(pixels[y][x] for y in range(h))]
+    ys = [y for y in range(h) if any(pixels[y][x] for x in range(w))]
+    if not xs:
+        return (0, 0, 0, 0)
+    return (xs[0], ys[0], xs[-1] - xs[0] + 1, ys[-1] - ys[0] + 1)
+
+
+def union(boxes):
+    boxes = [b for b in boxes if b[2] and b[3]]
+    if not boxes:
+        return (0, 0, 0, 0)
+    x0 = min(b[0] for b in boxes)
+    y0 = min(b[1] for b in boxes)
+    x1 = max(b[0] + b[2] for b in boxes)
+    y1 = max(b[1] + b[3] for b in boxes)
+    return (x0, y0, x1 - x0, y1 - y0)
+
+
+def ink_box(box):
+    """oled_canvas::ink for a bounding box; a blank canvas gets a single
+    pixel, since width 0 there means "not recorded"."""
+    return box if box[2] and box[3] else (0, 0, 1, 1)
+
+
+def page_span(box):
+    x, y, w, h = box
+    if not w or not h:
+        return (0, 0)
+    return (y // 8, (y + h - 1) // 8 - y // 8 + 1)
+
+
+def encode_pagemask(data, w, pages):
+    """Per-column masks of non-blank pages, then those bytes in order."""
+    masks, body = [], []
+    for x in range(w):
+        col = data[x * pages:(x + 1) * pages]
+        masks.append(sum(1 << p for p, b in enumerate(col) if b))
+        body.extend(b for b in col if b)
+    return masks + body
+
+
+def choose_encoding(data, w, pages):
+    """Smallest encoding for a canvas: (name, bytes)."""
+    options = [("raw", data)]
+    if pages <= 8:
+        options.append(("pagemask", encode_pagemask(data, w, pages)))
+    return min(options, key=lambda o: len(o[1]))
+
+
+def window_cost(win):
+    x0, x1, p0, p1 = win
+    return (x1 - x0 + 1) * (p1 - p0 + 1) + WINDOW_OVERHEAD
+
+
+def delta_windows(a, b, w, pages):
+    """Windows (x0, x1, p0, p1), inclusive, covering every byte that differs
+    between packed canvases a and b. Runs of changed columns are merged
+    left to right while one window is cheaper than two."""
+    wins = []
+    for x in range(w):
+        ps = [p for p in range(pages) if a[x * pages + p] != b[x * pages + p]]
+        if not ps:
+            continue
+        col = (x, x, ps[0], ps[-1])
+        if wins:
+            x0, _, p0, p1 = last = wins[-1]
+            merged = (x0, x, min(p0, ps[0]), max(p1, ps[-1]))
+            if window_cost(merged) <= window_cost(last) + window_cost(col):
+                wins[-1] = merged
+                continue
+        wins.append(col)
+    return wins
+
+
+def ink_cost(box_a, box_b):
+    """Bus bytes for sending the ink of both canvases as one window."""
+    x, y, w, h = union([box_a, box_b])
+    if not w or not h:
+        return 0
+    p0, pages = page_span((x, y, w, h))
+    return window_cost((x, x + w - 1, p0, p0 + pages - 1))
+
+
+def counter_transitions(n):
+    """(from, to) canvas index pairs a digit counter steps through: each to
+    the next, wrapping, and each back to the first."""
+    pairs = [(i, (i + 1) % n) for i in range(n)]
+    pairs += [(i, 0) for i in range(2, n) if (i, 0) not in pairs]
+    return pairs
+
+
+def emit_bytes(data, per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append("    " + "".join("0x%02X, " % b for b in data[i:i + per_line]))
+    lines[-1] = lines[-1].rstrip(", ")
+    return "\n".join(lines)
+
+
+def emit_list(items, per_line=5):
+    return ",\n".join("    " + ", ".join(items[i:i + per_line])
+                      for i in range(0, len(items), per_line))
+
+
+def generate(project, source_name):
+    templates = {t["id"]: t for t in project["templates"]}
+    out = []
+    w = out.append
+
+    w("// Generated by tools/oled_assets.py from %s - do not edit." % source_name)
+    w("// Canvas data is in the driver's native order (see oled_canvas.h).")
+    w("")
+    w("#ifndef SCREEN_IMAGES_H")
+    w("#define SCREEN_IMAGES_H")
+    w("")
+    w("#include <avr/pgmspace.h>")
+    w("")
+    w('#include "oled_blit.h"')
+    w('#include "oled_canvas.h"')
+    w("")
+    w("// 1 to store every canvas raw instead of encoded (more flash, no decoding)")
+    w("#ifndef OLED_ASSETS_RAW")
+    w("#define OLED_ASSETS_RAW 0")
+    w("#endif")
+    w("")
+    w("// a struct to represent the screen itself")
+    w("struct oled_screen {")
+    w("    const uint8_t width;")
+    w("    const uint8_t height;")
+    w("    uint8_t buffer[128 * 8];")
+    w("};")
+    w("")
+    w("// Copies a canvas to a specified region on the screen, respecting position.")
+    w("// Both the region and the canvas live in PROGMEM.")
+    w("static void displayCanvas(struct oled_screen* screen, const struct region* region, const oled_canvas* canvas) {")
+    w("    if (!screen || !region || !canvas) return;")
+    w("")
+    w("    struct region r;")
+    w("    memcpy_P(&r, region, sizeof(r));")
+    w("    const oled_target target = { screen->buffer, 0, screen->width, 0, uint8_t(screen->height / 8) };")
+    w("    oled_blit_canvas(target, r.x, r.y, canvas, r.width);")
+    w("}")
+    w("")
+    w("// -- Canvas Structs --")
+
+    transitions = []
+    template_boxes = {}
+    for t in project["templates"]:
+        tw, th = t["w"], t["h"]
+        tname = ident(t["name"])
+        boxes = []
+        names = []
+        packed = []
+        for c in t["canvases"]:
+            name = "%s_%s" % (tname, ident(c["name"]))
+            pixels = c["pixels"]
+            if len(pixels) != th or any(len(row) != tw for row in pixels):
+                raise ValueError("%s: pixels are not %dx%d" % (name, tw, th))
+            data = pack(pixels, tw, th)
+            box = bbox(pixels, tw, th)
+            encoding, stored = choose_encoding(data, tw, (th + 7) // 8)
+            boxes.append(box)
+            names.append(name)
+            packed.append(data)
+            if encoding != "raw":
+                w("#if OLED_ASSETS_RAW")
+                w("const uint8_t %s_data[] PROGMEM = {" % name)
+                w(emit_bytes(data))
+                w("};")
+                w("#else")
+            w("const uint8_t %s_data[] PROGMEM = {" % name)
+            w(emit_bytes(stored))
+            w("};")
+            if encoding != "raw":
+                w("#endif")
+            w("")
+            w("const oled_canvas %s PROGMEM = {" % name)
+            w("    %d, // width" % tw)
+            w("    %d, // height" % ((th + 7) // 8 * 8))
+            w("    %s_data," % name)
+            if encoding != "raw":
+                w("    OLED_ASSETS_RAW ? OLED_ENC_RAW : %s," % ENCODINGS[encoding])
+            else:
+                w("    %s," % ENCODINGS[encoding])
+            w("    { %d, %d, %d, %d } // ink" % ink_box(box))
+            w("};")
+            w("")
+        w("const oled_canvas *const %s_canvases[%d] PROGMEM = {" % (tname, len(names)))
+        w(emit_list(["&" + n for n in names]))
+        w("};")
+        w("")
+        template_boxes[t["id"]] = union(boxes)
+        pages = (th + 7) // 8
+        for i, j in counter_transitions(len(names)) if len(names) > 1 else []:
+            wins = delta_windows(packed[i], packed[j], tw, pages)
+            cost = sum(window_cost(win) for win in wins)
+            if ink_cost(boxes[i], boxes[j]) - cost < DELTA_MIN_SAVING:
+                continue
+            delta = "%s_to_%s_delta" % (names[i], ident(t["canvases"][j]["name"]))
+            w("// %s -> %s: %d bus bytes instead of %d"
+              % (names[i], names[j], cost, ink_cost(boxes[i], boxes[j])))
+            w("const oled_window %s[%d] PROGMEM = {" % (delta, len(wins)))
+            w(emit_list(["{ %d, %d, %d, %d }" % win for win in wins], 3))
+            w("};")
+            w("")
+            transitions.append("{ &%s, &%s, %s, %d }" % (names[i], names[j], delta, len(wins)))
+
+    w("// Transitions with delta windows, for GME12864_OLED::setTransitions()")
+    w("constexpr uint8_t SCREEN_TRANSITION_COUNT = %d;" % len(transitions))
+    if transitions:
+        w("const oled_transition screen_transitions[SCREEN_TRANSITION_COUNT] PROGMEM = {")
+        w(",\n".join("    " + tr for tr in transitions))
+        w("};")
+    else:
+        w("const oled_transition *const screen_transitions = nullptr;")
+    w("")
+    w("// Pre-defined regions for drawing")
+    regions = project["regions"]
+    for r in regions:
+        t = templates[r["templateId"]]
+        w("const struct region %s PROGMEM = { .x = %d, .y = %d, .width = %d, .height = %d };"
+          % (ident(r["name"]), r["x"], r["y"], t["w"], t["h"]))
+    w("")
+    placed = []
+    for r in regions:
+        x, y, bw, bh = template_boxes[r["templateId"]]
+        if bw and bh and r["x"] + x < 128 and r["y"] + y < 64:
+            x0, y0 = r["x"] + x, r["y"] + y
+            placed.append((x0, y0, min(bw, 128 - x0), min(bh, 64 - y0)))
+    w("// Screen area the regions can draw ink into (e.g. the rows for")
+    w("// GME12864_OLED::setUsedRows())")
+    w("constexpr struct region screen_ink = { %d, %d, %d, %d };" % union(placed))
+    w("")
+    w("#endif // SCREEN_IMAGES_H")
+    return "\n".join(out) + "\n"
+
+
+def build(src, dst):
+    """Regenerate dst from src; returns True if dst changed."""
+    with open(src) as f:
+        text = generate(json.load(f), os.path.basename(src))
+    if os.path.exists(dst):
+        with open(dst) as f:
+            if f.read() == text:
+                return False
+    with open(dst, "w") as f:
+        f.write(text)
+    return True
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("project", help="olEDitor JSON export")
+    ap.add_argument("header", help="header to write")
+    args = ap.parse_args()
+    changed = build(args.project, args.header)
+    print("%s %s" % (args.header, "updated" if changed else "up to date"))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
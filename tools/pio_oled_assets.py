@@ -0,0 +1,23 @@
+# PlatformIO pre-script: regenerate include/screen_images.h from the
+# olEDitor project named by `custom_oled_project` whenever the JSON (or the
+# generator) is newer than the header. See tools/oled_assets.py.
+
+import os
+import sys
+
+Import("env")  # noqa: F821 (provided by PlatformIO)
+
+project_dir = env.subst("$PROJECT_DIR")  # noqa: F821
+sys.path.insert(0, os.path.join(project_dir, "tools"))
+import oled_assets  # noqa: E402
+
+src = os.path.join(project_dir, env.GetProjectOption("custom_oled_project"))  # noqa: F821
+dst = os.path.join(project_dir, "include", "screen_images.h")
+tool = os.path.join(project_dir, "tools", "oled_assets.py")
+
+newest = max(os.path.getmtime(src), os.path.getmtime(tool))
+if not os.path.exists(dst) or os.path.getmtime(dst) < newest:
+    if oled_assets.build(src, dst):
+        print("oled_assets: regenerated %s" % os.path.relpath(dst, project_dir))
+    else:
+        os.utime(dst, None)
@@ -0,0 +1,165 @@
+// simavr_bench.c
+//
+// Runs the bench firmware (src/bench/) in simavr with the board it needs,
+// which the stock simavr binary does not model:
+//
+// - pull-up resistors on SDA (PB0) and SCL (PB2): a released line reads
+//   high. The bit-bang backends drive a line low by making the pin an
+//   output with PORTB = 0 and release it by making it an input, so without
+//   them SCL reads low and every transfer times out;
+// - an SSD1306 at 0x3C that ACKs its address (write) and every byte after
+//   it, and NACKs any other address.
+//
+// The core, clock, console and VCD trace come from the firmware's .mmcu
+// section (src/bench/simavr_mmcu.c), as with the stock binary. The bus
+// model runs after every instruction: it works out the line levels from
+// DDRB/PORTB and the slave, feeds them to the PINB bits of released pins
+// and follows SCL edges bit by bit. The slave answers instantly and never
+// stretches SCL.
+//
+//   cc -O2 -I/usr/include/simavr tools/simavr_bench.c -lsimavr -lelf -o simavr_bench
+//   ./simavr_bench .pio/build/bench/firmware.elf
+//
+// tools/bench.py builds and runs it. Exits non-zero if the core crashed.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "avr_ioport.h"
+#include "sim_avr.h"
+#include "sim_elf.h"
+
+#define SDA_BIT     (1 << 0) // PB0
+#define SCL_BIT     (1 << 2) // PB2
+#define SLAVE_ADDR  0x3C
+
+enum slave_state {
+    SLAVE_IDLE,    // waiting for a START
+    SLAVE_ADDRESS, // shifting in the address byte
+    SLAVE_DATA,    // shifting in data bytes
+    SLAVE_IGNORE   // not addressed: wait for the next START or STOP
+};
+
+struct bus {
+    avr_t *avr;
+    avr_irq_t *sda_pin;
+    avr_irq_t *scl_pin;
+    int sda, scl;            // line levels after the last instruction
+    enum slave_state state;
+    uint8_t byte;            // bits shifted in so far, MSB first
+    uint8_t bits;
+    int acking;              // slave holds SDA low for the ACK clock
+    unsigned long bytes_acked;
+};
+
+// Line level: low if the master drives it (output, PORTB bit 0) or, for
+// SDA, if the slave does; high through the pull-up otherwise.
+static int level(uint8_t ddr, uint8_t port, uint8_t bit, int slave_low) {
+    if ((ddr & bit) && !(port & bit)) return 0;
+    return !slave_low;
+}
+
+static void scl_rose(struct bus *b) {
+    if (b->acking || (b->state != SLAVE_ADDRESS && b->state != SLAVE_DATA)) return;
+    b->byte = (uint8_t)((b->byte << 1) | b->sda);
+    ++b->bits;
+}
+
+// After the eighth bit the slave takes SDA for the ACK clock, and lets go
+// once that clock falls.
+static void scl_fell(struct bus *b) {
+    if (b->acking) {
+        b->acking = 0;
+        return;
+    }
+    if (b->bits < 8) return;
+    b->bits = 0;
+    if (b->state == SLAVE_ADDRESS) {
+        if (b->byte != (SLAVE_ADDR << 1)) {
+            b->state = SLAVE_IGNORE;
+            return;
+        }
+        b->state = SLAVE_DATA;
+    } else if (b->state == SLAVE_DATA) {
+        ++b->bytes_acked;
+    } else {
+        return;
+    }
+    b->acking = 1;
+}
+
+static void bus_update(struct bus *b) {
+    avr_ioport_state_t io;
+    if (avr_ioctl(b->avr, AVR_IOCTL_IOPORT_GETSTATE('B'), &io) != 0) return;
+    uint8_t ddr = io.ddr, port = io.port, pin = io.pin;
+
+    int scl = level(ddr, port, SCL_BIT, 0);
+    int sda = level(ddr, port, SDA_BIT, b->acking);
+
+    if (scl != b->scl) {
+        b->scl = scl;
+        b->sda = sda;
+        if (scl) scl_rose(b);
+        else scl_fell(b);
+        sda = level(ddr, port, SDA_BIT, b->acking); // the slave may have let go
+    } else if (scl && sda != b->sda) {
+        if (!sda) {                                 // START (or repeated START)
+            b->state = SLAVE_ADDRESS;
+            b->byte = 0;
+            b->bits = 0;
+        } else {                                    // STOP
+            b->state = SLAVE_IDLE;
+        }
+        b->acking = 0;
+    }
+    b->sda = sda;
+
+    // Released pins read the line; a pin driven low already reads 0
+    if (!(ddr & SCL_BIT) && !!(pin & SCL_BIT) != scl) avr_raise_irq(b->scl_pin, scl);
+    if (!(ddr & SDA_BIT) && !!(pin & SDA_BIT) != sda) avr_raise_irq(b->sda_pin, sda);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s firmware.elf\n", argv[0]);
+        return 2;
+    }
+
+    elf_firmware_t f;
+    memset(&f, 0, sizeof(f));
+    if (elf_read_firmware(argv[1], &f) != 0) {
+        fprintf(stderr, "%s: cannot read %s\n", argv[0], argv[1]);
+        return 2;
+    }
+    if (!f.mmcu[0]) strcpy(f.mmcu, "attiny85");
+    if (!f.frequency) f.frequency = 8000000;
+
+    avr_t *avr = avr_make_mcu_by_name(f.mmcu);
+    if (!avr) {
+        fprintf(stderr, "%s: unknown core %s\n", argv[0], f.mmcu);
+        return 2;
+    }
+    avr_init(avr);
+    avr->log = LOG_ERROR;
+    avr_load_firmware(avr, &f);
+
+    struct bus b;
+    memset(&b, 0, sizeof(b));
+    b.avr = avr;
+    b.sda_pin = avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ('B'), IOPORT_IRQ_PIN0);
+    b.scl_pin = avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ('B'), IOPORT_IRQ_PIN2);
+    b.sda = b.scl = 1;
+    avr_raise_irq(b.sda_pin, 1);
+    avr_raise_irq(b.scl_pin, 1);
+
+    int state = cpu_Running;
+    while (state != cpu_Done && state != cpu_Crashed) {
+        state = avr_run(avr);
+        bus_update(&b);
+    }
+    printf("simavr_bench: %s, %lu data bytes ACKed at 0x%02X\n",
+           state == cpu_Done ? "done" : "crashed", b.bytes_acked, SLAVE_ADDR);
+    avr_terminate(avr);
+    return state == cpu_Done ? 0 : 1;
+}